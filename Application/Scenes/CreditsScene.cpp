@@ -4,9 +4,6 @@
 #include "Core/Input.h"
 #include "Utilities/DrawHelpers.h"
 
-#include <thread>
-#include <chrono>
-
 void CreditsScene::Initialize()
 {
     m_FlashCounter = 0;
@@ -24,6 +21,7 @@ void CreditsScene::Load()
     m_MouseButtonHandle = core::EventRegistry::Subscribe(EventType::MOUSE_BUTTON_EVENT,
         [this](io::Button btn) { HandleMouseButton(btn); });
 
+    m_Game.GetFramePacer().SetTargetRate(60);
     m_Game.SetRenderLoop([this]() { OnRender(); });
     m_Game.SetInputLoop([this]() { OnInput(); });
     m_Game.SetFinishingFunc([this]() { return !m_ShouldExit; });
@@ -86,9 +84,6 @@ void CreditsScene::OnRender()
     }
 
     gfx::Flush();
-
-    // Cap at ~60 FPS
-    std::this_thread::sleep_for(std::chrono::milliseconds(12));
 }
 
 void CreditsScene::OnInput()
@@ -15,8 +15,6 @@
 #include <string>
 #include <fstream>
 #include <sstream>
-#include <thread>
-#include <chrono>
 
 #include <nlohmann/json.hpp>
 #include <cmath>
@@ -49,7 +47,8 @@ void GameScene::Load()
     m_ParallaxBackground = m_Loader.Load(std::string(ASSETS) + "/Textures/background.png");
 
     // Load tileset and configure TileLayer
-    gfx::Bitmap tileset = m_Loader.Load(std::string(ASSETS) + "/Textures/tiles_first_map_fixed.png");
+    std::string tilesetPath = std::string(ASSETS) + "/Textures/tiles_first_map_fixed.png";
+    gfx::Bitmap tileset = m_Loader.Load(tilesetPath);
 
     scene::TileConfig tileConfig;
     tileConfig.totalCols = 40;
@@ -67,14 +66,7 @@ void GameScene::Load()
     m_TileLayer.SetTileset(tileset);
 
     // Load tile map
-    std::ifstream tileFile(std::string(ASSETS) + "/Terrain/sonic_level.csv");
-    if (tileFile.is_open())
-    {
-        std::stringstream buffer;
-        buffer << tileFile.rdbuf();
-        tileFile.close();
-        m_TileLayer.LoadFromCSV(buffer.str());
-    }
+    m_TileLayer.LoadFromCSVFile(std::string(ASSETS) + "/Terrain/sonic_level.csv");
 
     // Configure and load GridMap
     // Using 1x1 pixel grid for precise collision detection (especially for ramps)
@@ -95,20 +87,17 @@ void GameScene::Load()
 
     if (!m_Grid.LoadFromRLE(rlePath))
     {
-        // RLE not found or invalid, load from CSV
-        std::ifstream gridFile(csvPath);
-        if (gridFile.is_open())
+        // RLE not found or invalid, load from CSV or bake it from the tile art
+        if (m_Grid.LoadFromCSVFile(csvPath) || m_Grid.BakeFromTileset(m_TileLayer, tilesetPath))
         {
-            std::stringstream buffer;
-            buffer << gridFile.rdbuf();
-            gridFile.close();
-            m_Grid.LoadFromCSV(buffer.str());
-
             // Auto-save as RLE for faster loading next time
             m_Grid.SaveToRLE(rlePath);
         }
     }
 
+    // Page grid chunks around the camera instead of decoding the whole level
+    m_LevelStreamer.Start(&m_Grid, scene::StreamConfig{});
+
     // Setup clipper for sprite rendering
     m_Clipper.SetView([this, vpW, vpH]() -> const Rect& {
         static Rect viewRect;
@@ -176,6 +165,10 @@ void GameScene::Load()
     for (auto* masher : m_Mashers)
     {
         masher->StartAnimation();
+        m_Activity.Add(masher, masher->GetAnimator(), [masher]() {
+            if (masher->IsAlive())
+                masher->Update();
+        });
     }
 
     // Create Crabmeat enemy at the start of the level
@@ -189,6 +182,10 @@ void GameScene::Load()
     for (auto* crabmeat : m_Crabmeats)
     {
         crabmeat->StartAnimation();
+        m_Activity.Add(crabmeat, crabmeat->GetAnimator(), [crabmeat]() {
+            if (crabmeat->IsAlive())
+                crabmeat->Update();
+        });
     }
 
     // Create bridge (decorative element)
@@ -235,11 +232,14 @@ void GameScene::Load()
     sound::PlayTrack(m_BackgroundMusic, -1);  // -1 for infinite looping
     sound::SetTrackVolume(m_BackgroundMusic, 0.3f);  // Lower volume so SFX can be heard
 
-    // Configure game loop
+    // Configure game loop. Gameplay counts in 60 Hz frames (jump cooldowns,
+    // invincibility, per-frame velocities), so simulate at a fixed 60 Hz and
+    // let the game advance the clock one step at a time.
+    m_Game.SetFixedStep(60);
+    m_Game.GetFramePacer().SetTargetRate(60);
     m_Game.SetRenderLoop([this]() { OnRender(); });
     m_Game.SetInputLoop([this]() { OnInput(); });
     m_Game.SetAnimationLoop([]() {
-        core::SystemClock::Get().SetCurrTime();
         TimeStamp currTime = core::SystemClock::Get().GetCurrTime();
         anim::AnimatorManager::Get().Progress(currTime);
         GameStats::Get().UpdateTimer(currTime);
@@ -258,37 +258,28 @@ void GameScene::Clear()
         m_BackgroundMusic = nullptr;
     }
 
-    // Cancel collision registrations before destroying sprites
+    // Take sprites out of the collision checker before destroying them
     auto& checker = physics::CollisionChecker::Get();
+    auto removeCollider = [&checker](scene::Sprite* sprite) {
+        if (sprite && checker.In(sprite))
+            checker.Remove(sprite);
+    };
     for (auto* ring : m_Rings)
-    {
-        checker.Cancel(m_Sonic, ring);
-    }
+        removeCollider(ring);
     for (auto* ring : m_ScatteredRings)
-    {
-        checker.Cancel(m_Sonic, ring);
-    }
+        removeCollider(ring);
     for (auto* masher : m_Mashers)
-    {
-        checker.Cancel(m_Sonic, masher);
-    }
+        removeCollider(masher);
     for (auto* crabmeat : m_Crabmeats)
-    {
-        checker.Cancel(m_Sonic, crabmeat);
-        // Cancel bullet collisions
-        for (auto* bullet : crabmeat->GetBullets())
-        {
-            checker.Cancel(m_Sonic, bullet);
-        }
-    }
+        removeCollider(crabmeat);
     for (auto* checkpoint : m_Checkpoints)
-    {
-        checker.Cancel(m_Sonic, checkpoint);
-    }
-    if (m_FinalRing)
-    {
-        checker.Cancel(m_Sonic, m_FinalRing);
-    }
+        removeCollider(checkpoint);
+    removeCollider(m_FinalRing);
+    removeCollider(m_Sonic);
+    checker.ClearHandlers();
+
+    // Hand parked animators back before their sprites go away
+    m_Activity.Clear();
 
     // Destroy sprites using the engine's destruction system
     for (auto* ring : m_Rings)
@@ -354,6 +345,8 @@ void GameScene::Clear()
     // Commit destruction to actually delete the objects
     core::DestructionManager::Get().Commit();
 
+    m_LevelStreamer.Stop();
+
     // Explicitly reset event handles to unsubscribe before destruction
     m_CloseHandle = core::EventHandle();
     m_KeyHandle = core::EventHandle();
@@ -574,37 +567,13 @@ void GameScene::OnRender()
     // Render ending sequence overlay
     if (m_EndingState != EndingState::NONE && m_FadeAlpha > 0.0f)
     {
-        // Draw fade overlay using direct pixel manipulation
-        if (gfx::BitmapLock(screen))
-        {
-            uint8_t* base = gfx::BitmapGetMemory(screen);
-            int pitch = gfx::BitmapGetLineOffset(screen);
-            uint8_t fadeAmount = static_cast<uint8_t>(m_FadeAlpha * 255.0f);
-
-            // Get color component extraction info
-            unsigned redShift = gfx::GetRedShiftRGBA();
-            unsigned greenShift = gfx::GetGreenShiftRGBA();
-            unsigned blueShift = gfx::GetBlueShiftRGBA();
-
-            for (int y = 0; y < vpH; ++y)
-            {
-                gfx::Color* row = reinterpret_cast<gfx::Color*>(base + y * pitch);
-                for (int x = 0; x < vpW; ++x)
-                {
-                    // Extract color components
-                    uint8_t r = static_cast<uint8_t>((row[x] >> redShift) & 0xFF);
-                    uint8_t g = static_cast<uint8_t>((row[x] >> greenShift) & 0xFF);
-                    uint8_t b = static_cast<uint8_t>((row[x] >> blueShift) & 0xFF);
-
-                    // Blend towards black (0, 0, 0)
-                    r = static_cast<uint8_t>((r * (255 - fadeAmount)) / 255);
-                    g = static_cast<uint8_t>((g * (255 - fadeAmount)) / 255);
-                    b = static_cast<uint8_t>((b * (255 - fadeAmount)) / 255);
-                    row[x] = gfx::MakeColor(r, g, b, 255);
-                }
-            }
-            gfx::BitmapUnlock(screen);
-        }
+        // Darken the scene towards black
+        gfx::BitmapFillRectBlended(
+            screen,
+            { 0, 0, vpW, vpH },
+            gfx::MakeColor(0, 0, 0, 255),
+            static_cast<gfx::Alpha>(m_FadeAlpha * 255.0f)
+        );
 
         // Render end screen sprites when fully faded
         if (m_EndingState == EndingState::SHOWING_END && m_EndingSonicFilm && m_EndingLogoFilm)
@@ -641,37 +610,13 @@ void GameScene::OnRender()
     // Render death sequence fade overlay
     if (m_DeathState != DeathState::NONE && m_DeathFadeAlpha > 0.0f)
     {
-        // Draw fade overlay using direct pixel manipulation
-        if (gfx::BitmapLock(screen))
-        {
-            uint8_t* base = gfx::BitmapGetMemory(screen);
-            int pitch = gfx::BitmapGetLineOffset(screen);
-            uint8_t fadeAmount = static_cast<uint8_t>(m_DeathFadeAlpha * 255.0f);
-
-            // Get color component extraction info
-            unsigned redShift = gfx::GetRedShiftRGBA();
-            unsigned greenShift = gfx::GetGreenShiftRGBA();
-            unsigned blueShift = gfx::GetBlueShiftRGBA();
-
-            for (int y = 0; y < vpH; ++y)
-            {
-                gfx::Color* row = reinterpret_cast<gfx::Color*>(base + y * pitch);
-                for (int x = 0; x < vpW; ++x)
-                {
-                    // Extract color components
-                    uint8_t r = static_cast<uint8_t>((row[x] >> redShift) & 0xFF);
-                    uint8_t g = static_cast<uint8_t>((row[x] >> greenShift) & 0xFF);
-                    uint8_t b = static_cast<uint8_t>((row[x] >> blueShift) & 0xFF);
-
-                    // Blend towards black
-                    r = static_cast<uint8_t>((r * (255 - fadeAmount)) / 255);
-                    g = static_cast<uint8_t>((g * (255 - fadeAmount)) / 255);
-                    b = static_cast<uint8_t>((b * (255 - fadeAmount)) / 255);
-                    row[x] = gfx::MakeColor(r, g, b, 255);
-                }
-            }
-            gfx::BitmapUnlock(screen);
-        }
+        // Darken the scene towards black
+        gfx::BitmapFillRectBlended(
+            screen,
+            { 0, 0, vpW, vpH },
+            gfx::MakeColor(0, 0, 0, 255),
+            static_cast<gfx::Alpha>(m_DeathFadeAlpha * 255.0f)
+        );
     }
 
     // Render pause menu overlay if game is paused
@@ -680,10 +625,12 @@ void GameScene::OnRender()
         RenderPauseMenu(screen, vpW, vpH);
     }
 
-    gfx::Flush();
+    if (m_Game.GetProfiler().IsOverlayVisible())
+    {
+        draw::ProfilerOverlay(screen, vpW - 256, 8, m_Game.GetProfiler());
+    }
 
-    // Cap at ~60 FPS
-    std::this_thread::sleep_for(std::chrono::milliseconds(12));
+    gfx::Flush();
 }
 
 void GameScene::OnInput()
@@ -717,24 +664,17 @@ void GameScene::OnInput()
         return;
     }
 
-    // Update enemies
-    for (auto* masher : m_Mashers)
-    {
-        if (masher->IsAlive())
-        {
-            masher->Update();
-        }
-    }
+    // Update the enemies and scattered rings near the camera
+    m_Activity.Tick();
 
+    // Bullets already in flight keep moving while their crabmeat sleeps
     for (auto* crabmeat : m_Crabmeats)
     {
-        if (crabmeat->IsAlive())
-        {
-            crabmeat->Update();
-        }
+        if (crabmeat->IsAlive() && !m_Activity.IsAwake(crabmeat))
+            crabmeat->UpdateBullets();
     }
 
-    // Update scattered rings (physics and cleanup)
+    // Clean up scattered rings
     UpdateScatteredRings();
 
     // Update Sonic and make camera follow
@@ -784,6 +724,9 @@ void GameScene::OnInput()
 
         m_CameraY = static_cast<int>(m_CameraSmoothY);
         ClampCamera();
+
+        m_LevelStreamer.Update({ m_CameraX, m_CameraY, vpW, vpH });
+        m_Activity.Update({ m_CameraX, m_CameraY, vpW, vpH });
     }
 }
 
@@ -802,6 +745,10 @@ void GameScene::HandleKeyEvent(io::Key key)
     {
         m_ShowGrid = !m_ShowGrid;
     }
+    else if (key == io::Key::F3)
+    {
+        m_Game.GetProfiler().ToggleOverlay();
+    }
     else if (key == io::Key::Escape)
     {
         // Pause the game and show pause menu
@@ -873,113 +820,133 @@ void GameScene::RegisterCollisions()
 {
     auto& checker = physics::CollisionChecker::Get();
 
-    // Register Sonic vs each Ring
+    // Sonic hits every other layer, the rest only hit Sonic
+    m_Sonic->SetCollisionLayer(LAYER_SONIC, physics::COLLISION_MASK_ALL & ~physics::LayerBit(LAYER_SONIC));
+    checker.Add(m_Sonic);
+
+    auto addCollider = [&checker](scene::Sprite* sprite, physics::CollisionLayer layer) {
+        sprite->SetCollisionLayer(layer, physics::LayerBit(LAYER_SONIC));
+        checker.Add(sprite);
+    };
+
+    // Sonic vs Rings
     for (auto* ring : m_Rings)
-    {
-        checker.Register(m_Sonic, ring,
-            [](scene::Sprite* sonic, scene::Sprite* ringSprite) {
-                Ring* ring = static_cast<Ring*>(ringSprite);
-                if (!ring->IsCollected())
-                {
-                    ring->OnCollected();
-                }
+        addCollider(ring, LAYER_RING);
+
+    checker.SetHandler(LAYER_SONIC, LAYER_RING,
+        [](scene::Sprite* sonic, scene::Sprite* ringSprite) {
+            Ring* ring = static_cast<Ring*>(ringSprite);
+            if (!ring->IsCollected())
+            {
+                ring->OnCollected();
             }
-        );
-    }
+        }
+    );
 
-    // Register Sonic vs Checkpoints
+    // Sonic vs Checkpoints
     for (auto* checkpoint : m_Checkpoints)
-    {
-        checker.Register(m_Sonic, checkpoint,
-            [this](scene::Sprite* sonic, scene::Sprite* checkpointSprite) {
-                Checkpoint* cp = static_cast<Checkpoint*>(checkpointSprite);
-                if (!cp->IsTriggered())
-                {
-                    cp->OnTriggered();
-                    // Save checkpoint position as respawn point (spawn above the checkpoint)
-                    Rect box = cp->GetBox();
-                    m_RespawnPosition = {box.x, box.y - 40};
-                }
+        addCollider(checkpoint, LAYER_CHECKPOINT);
+
+    checker.SetHandler(LAYER_SONIC, LAYER_CHECKPOINT,
+        [this](scene::Sprite* sonic, scene::Sprite* checkpointSprite) {
+            Checkpoint* cp = static_cast<Checkpoint*>(checkpointSprite);
+            if (!cp->IsTriggered())
+            {
+                cp->OnTriggered();
+                // Save checkpoint position as respawn point (spawn above the checkpoint)
+                Rect box = cp->GetBox();
+                m_RespawnPosition = {box.x, box.y - 40};
             }
-        );
-    }
+        }
+    );
 
-    // Register Sonic vs FinalRing (goal)
+    // Sonic vs FinalRing (goal)
     if (m_FinalRing)
-    {
-        checker.Register(m_Sonic, m_FinalRing,
-            [this](scene::Sprite* sonic, scene::Sprite* finalRingSprite) {
-                FinalRing* finalRing = static_cast<FinalRing*>(finalRingSprite);
-                if (!finalRing->IsCollected())
+        addCollider(m_FinalRing, LAYER_FINAL_RING);
+
+    checker.SetHandler(LAYER_SONIC, LAYER_FINAL_RING,
+        [this](scene::Sprite* sonic, scene::Sprite* finalRingSprite) {
+            FinalRing* finalRing = static_cast<FinalRing*>(finalRingSprite);
+            if (!finalRing->IsCollected())
+            {
+                // Stop background music to let stage clear theme play
+                if (m_BackgroundMusic)
                 {
-                    // Stop background music to let stage clear theme play
-                    if (m_BackgroundMusic)
-                    {
-                        sound::StopTrack(m_BackgroundMusic, 500);  // 500ms fade out
-                    }
-                    finalRing->OnCollected();
+                    sound::StopTrack(m_BackgroundMusic, 500);  // 500ms fade out
                 }
+                finalRing->OnCollected();
             }
-        );
-    }
+        }
+    );
 
-    // Register Sonic vs Mashers (enemies)
+    // Sonic vs Mashers (enemies)
     for (auto* masher : m_Mashers)
-    {
-        checker.Register(m_Sonic, masher,
-            [](scene::Sprite* sonicSprite, scene::Sprite* masherSprite) {
-                Sonic* sonic = static_cast<Sonic*>(sonicSprite);
-                Masher* masher = static_cast<Masher*>(masherSprite);
-                if (!masher->IsAlive())
-                    return;
-
-                // When invincible, Sonic can't interact with enemies at all
-                if (sonic->IsInvincible())
-                    return;
-
-                // If Sonic is in ball state (spinning/jumping), he kills the enemy
-                if (sonic->IsInBallState())
-                {
-                    masher->Kill();
-                    sonic->BounceOffEnemy();
-                }
-                // Otherwise, Sonic takes damage
-                else
-                {
-                    sonic->OnHit();
-                }
+        addCollider(masher, LAYER_MASHER);
+
+    checker.SetHandler(LAYER_SONIC, LAYER_MASHER,
+        [](scene::Sprite* sonicSprite, scene::Sprite* masherSprite) {
+            Sonic* sonic = static_cast<Sonic*>(sonicSprite);
+            Masher* masher = static_cast<Masher*>(masherSprite);
+            if (!masher->IsAlive())
+                return;
+
+            // When invincible, Sonic can't interact with enemies at all
+            if (sonic->IsInvincible())
+                return;
+
+            // If Sonic is in ball state (spinning/jumping), he kills the enemy
+            if (sonic->IsInBallState())
+            {
+                masher->Kill();
+                sonic->BounceOffEnemy();
             }
-        );
-    }
+            // Otherwise, Sonic takes damage
+            else
+            {
+                sonic->OnHit();
+            }
+        }
+    );
 
-    // Register Sonic vs Crabmeats (enemies)
+    // Sonic vs Crabmeats (enemies)
     for (auto* crabmeat : m_Crabmeats)
-    {
-        checker.Register(m_Sonic, crabmeat,
-            [](scene::Sprite* sonicSprite, scene::Sprite* crabmeatSprite) {
-                Sonic* sonic = static_cast<Sonic*>(sonicSprite);
-                Crabmeat* crabmeat = static_cast<Crabmeat*>(crabmeatSprite);
-                if (!crabmeat->IsAlive())
-                    return;
-
-                // When invincible, Sonic can't interact with enemies at all
-                if (sonic->IsInvincible())
-                    return;
-
-                // If Sonic is in ball state (spinning/jumping), he kills the enemy
-                if (sonic->IsInBallState())
-                {
-                    crabmeat->Kill();
-                    sonic->BounceOffEnemy();
-                }
-                // Otherwise, Sonic takes damage
-                else
-                {
-                    sonic->OnHit();
-                }
+        addCollider(crabmeat, LAYER_CRABMEAT);
+
+    checker.SetHandler(LAYER_SONIC, LAYER_CRABMEAT,
+        [](scene::Sprite* sonicSprite, scene::Sprite* crabmeatSprite) {
+            Sonic* sonic = static_cast<Sonic*>(sonicSprite);
+            Crabmeat* crabmeat = static_cast<Crabmeat*>(crabmeatSprite);
+            if (!crabmeat->IsAlive())
+                return;
+
+            // When invincible, Sonic can't interact with enemies at all
+            if (sonic->IsInvincible())
+                return;
+
+            // If Sonic is in ball state (spinning/jumping), he kills the enemy
+            if (sonic->IsInBallState())
+            {
+                crabmeat->Kill();
+                sonic->BounceOffEnemy();
             }
-        );
-    }
+            // Otherwise, Sonic takes damage
+            else
+            {
+                sonic->OnHit();
+            }
+        }
+    );
+
+    // Sonic vs ScatteredRings, the rings themselves are added as they spawn
+    checker.SetHandler(LAYER_SONIC, LAYER_SCATTERED_RING,
+        [](scene::Sprite* sonicSprite, scene::Sprite* ringSprite) {
+            ScatteredRing* ring = static_cast<ScatteredRing*>(ringSprite);
+            if (ring->IsCollectable() && !ring->IsCollected())
+            {
+                ring->OnCollected();
+            }
+        }
+    );
 }
 
 void GameScene::OnCollisionCheckLoop()
@@ -1067,34 +1034,9 @@ void GameScene::LoadRings()
 
 void GameScene::RenderPauseMenu(gfx::Bitmap screen, int vpW, int vpH)
 {
-    // Draw semi-transparent dark overlay
-    if (gfx::BitmapLock(screen))
-    {
-        uint8_t* base = gfx::BitmapGetMemory(screen);
-        int pitch = gfx::BitmapGetLineOffset(screen);
-        constexpr uint8_t darkenAmount = 128;  // 50% darkening
-
-        unsigned redShift = gfx::GetRedShiftRGBA();
-        unsigned greenShift = gfx::GetGreenShiftRGBA();
-        unsigned blueShift = gfx::GetBlueShiftRGBA();
-
-        for (int y = 0; y < vpH; ++y)
-        {
-            gfx::Color* row = reinterpret_cast<gfx::Color*>(base + y * pitch);
-            for (int x = 0; x < vpW; ++x)
-            {
-                uint8_t r = static_cast<uint8_t>((row[x] >> redShift) & 0xFF);
-                uint8_t g = static_cast<uint8_t>((row[x] >> greenShift) & 0xFF);
-                uint8_t b = static_cast<uint8_t>((row[x] >> blueShift) & 0xFF);
-
-                r = static_cast<uint8_t>((r * (255 - darkenAmount)) / 255);
-                g = static_cast<uint8_t>((g * (255 - darkenAmount)) / 255);
-                b = static_cast<uint8_t>((b * (255 - darkenAmount)) / 255);
-                row[x] = gfx::MakeColor(r, g, b, 255);
-            }
-        }
-        gfx::BitmapUnlock(screen);
-    }
+    // Draw semi-transparent dark overlay (50% darkening)
+    constexpr gfx::Alpha darkenAmount = 128;
+    gfx::BitmapFillRectBlended(screen, { 0, 0, vpW, vpH }, gfx::MakeColor(0, 0, 0, 255), darkenAmount);
 
     // Menu dimensions
     constexpr int BUTTON_WIDTH = 120;
@@ -1234,35 +1176,25 @@ void GameScene::SpawnScatteredRings(int x, int y, int count)
         auto* ring = new ScatteredRing(x, y, vx, vy);
         ring->StartAnimation();
         m_ScatteredRings.push_back(ring);
+        m_Activity.Add(ring, nullptr, [ring]() { ring->Update(); });
 
-        // Register collision with Sonic
-        physics::CollisionChecker::Get().Register(m_Sonic, ring,
-            [](scene::Sprite* sonicSprite, scene::Sprite* ringSprite) {
-                ScatteredRing* ring = static_cast<ScatteredRing*>(ringSprite);
-                if (ring->IsCollectable() && !ring->IsCollected())
-                {
-                    ring->OnCollected();
-                }
-            }
-        );
+        // Collides with Sonic through the scattered ring handler
+        ring->SetCollisionLayer(LAYER_SCATTERED_RING, physics::LayerBit(LAYER_SONIC));
+        physics::CollisionChecker::Get().Add(ring);
     }
 }
 
 void GameScene::UpdateScatteredRings()
 {
-    // Update all scattered rings (physics)
-    for (auto* ring : m_ScatteredRings)
-    {
-        ring->Update();
-    }
-
-    // Remove expired or collected rings
+    // Physics runs from the activity region tick. Remove expired or collected
+    // rings, and like the original, drop the ones that left the active area.
     auto it = m_ScatteredRings.begin();
     while (it != m_ScatteredRings.end())
     {
-        if ((*it)->IsExpired() || (*it)->IsCollectionFinished())
+        if ((*it)->IsExpired() || (*it)->IsCollectionFinished() || !m_Activity.IsAwake(*it))
         {
-            physics::CollisionChecker::Get().Cancel(m_Sonic, *it);
+            m_Activity.Remove(*it);
+            physics::CollisionChecker::Get().Remove(*it);
             (*it)->Destroy();
             it = m_ScatteredRings.erase(it);
         }
@@ -6,6 +6,8 @@
 #include "Rendering/Clipper.h"
 #include "Scene/GridLayer.h"
 #include "Scene/TileLayer.h"
+#include "Scene/LevelStreamer.h"
+#include "Scene/ActivityRegion.h"
 
 #include "Sprites/Ring.h"
 #include "Sprites/ScatteredRing.h"
@@ -45,6 +47,18 @@ private:
     };
     static constexpr int PAUSE_MENU_OPTIONS = 3;
 
+    // Collision layers, everything only collides with Sonic
+    enum CollisionLayers : physics::CollisionLayer
+    {
+        LAYER_SONIC = 0,
+        LAYER_RING,
+        LAYER_SCATTERED_RING,
+        LAYER_CHECKPOINT,
+        LAYER_FINAL_RING,
+        LAYER_MASHER,
+        LAYER_CRABMEAT
+    };
+
     // Ending sequence states
     enum class EndingState
     {
@@ -88,6 +102,7 @@ private:
     gfx::Bitmap m_ParallaxBackground = nullptr;
     scene::TileLayer m_TileLayer;
     scene::GridMap m_Grid;
+    scene::LevelStreamer m_LevelStreamer;  // after m_Grid, stops before it is destroyed
 
     // Camera state
     int m_CameraX = 0;
@@ -108,6 +123,7 @@ private:
     std::vector<Flower*> m_Flowers;
     std::vector<Masher*> m_Mashers;
     std::vector<Crabmeat*> m_Crabmeats;
+    scene::ActivityRegion m_Activity;  // sleeps objects away from the camera
     Bridge* m_Bridge = nullptr;
     Bridge* m_Bridge2 = nullptr;
     std::vector<Checkpoint*> m_Checkpoints;
@@ -6,8 +6,6 @@
 #include "Utilities/MenuConstants.h"
 
 #include <string>
-#include <thread>
-#include <chrono>
 
 void MenuScene::Initialize()
 {
@@ -47,6 +45,7 @@ void MenuScene::Load()
         [this](io::Button btn) { HandleMouseButton(btn); });
 
     // Configure game loop
+    m_Game.GetFramePacer().SetTargetRate(60);
     m_Game.SetRenderLoop([this]() { OnRender(); });
     m_Game.SetInputLoop([this]() { OnInput(); });
     m_Game.SetFinishingFunc([this]() { return !m_ShouldExit; });
@@ -108,9 +107,6 @@ void MenuScene::OnRender()
     }
 
     gfx::Flush();
-
-    // Cap at ~60 FPS
-    std::this_thread::sleep_for(std::chrono::milliseconds(12));
 }
 
 void MenuScene::OnInput()
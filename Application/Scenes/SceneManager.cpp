@@ -6,6 +6,7 @@
 #include "Sound/Sound.h"
 #include "Core/Input.h"
 #include "Utilities/FilmParser.h"
+#include "Animations/AnimationFilmHolder.h"
 
 SceneManager& SceneManager::Get()
 {
@@ -38,6 +39,9 @@ void SceneManager::Shutdown()
     if (!m_Initialized) return;
 
     sound::Close();
+
+    // Film atlases are textures, release them while the renderer is alive
+    anim::AnimationFilmHolder::Get().CleanUp();
     gfx::Close();
 
     m_Initialized = false;
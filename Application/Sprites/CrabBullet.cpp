@@ -102,20 +102,16 @@ void CrabBullet::Update()
             m_VelocityY = MAX_FALL_SPEED;
     }
 
-    // Move the bullet
-    m_X += m_VelocityX;
-    m_Y += m_VelocityY;
-
-    // Check terrain collision
+    // Sweep the bullet center along this frame's motion so fast shots
+    // cannot tunnel through thin terrain between two sampled positions
     if (m_Grid)
     {
-        // Check center point of bullet against terrain
-        int centerX = m_X + 8;
-        int centerY = m_Y + 8;
-
-        // Check if the bullet hit solid terrain
-        GridIndex gridValue = m_Grid->GetGridTile(centerX, centerY);
-        if (gridValue != scene::GRID_EMPTY_TILE)
+        Rect center{ m_X + 8, m_Y + 8, 1, 1 };
+        scene::SweepHit hit = m_Grid->SweepAABB(
+            center, m_VelocityX, m_VelocityY,
+            static_cast<GridIndex>(~scene::GRID_EMPTY_TILE)
+        );
+        if (hit.hit)
         {
             m_IsActive = false;
             SetVisibility(false);
@@ -123,6 +119,10 @@ void CrabBullet::Update()
         }
     }
 
+    // Move the bullet
+    m_X += m_VelocityX;
+    m_Y += m_VelocityY;
+
     // Update bounding area
     auto* box = static_cast<physics::BoundingBox*>(m_BoundingArea);
     box->x1 = m_X;
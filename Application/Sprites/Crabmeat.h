@@ -21,7 +21,9 @@ public:
 
     void StartAnimation();
     void StopAnimation();
+    anim::Animator* GetAnimator() const { return m_Animator; }
     void Update();
+    void UpdateBullets();
     bool IsAlive() const { return m_IsAlive; }
     void Kill();
 
@@ -33,7 +35,6 @@ private:
     void SetState(State newState);
     void UpdateAnimation();
     void FireBullets();
-    void UpdateBullets();
 
     // Films (owned by AnimationFilmHolder)
     anim::AnimationFilm* m_IdleFilm = nullptr;
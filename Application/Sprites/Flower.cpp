@@ -1,9 +1,9 @@
 #include "Sprites/Flower.h"
 #include "Animations/AnimationFilmHolder.h"
-#include "Core/SystemClock.h"
 
 Flower::Flower(int x, int y, const std::string& filmId)
     : scene::Sprite(x, y, "Flower")
+    , m_FilmId(filmId)
 {
     m_Film = const_cast<anim::AnimationFilm*>(
         anim::AnimationFilmHolder::Get().GetFilm(filmId)
@@ -14,59 +14,30 @@ Flower::Flower(int x, int y, const std::string& filmId)
     SetFrame(0);
     SetVisibility(true);
     SetHasDirectMotion(true);
-
-    // Create idle animation (loops forever)
-    unsigned endFrame = m_Film ? static_cast<unsigned>(m_Film->GetTotalFrames() - 1) : 0;
-    m_Animation = new anim::FrameRangeAnimation(
-        filmId + ".anim",
-        0,
-        endFrame,
-        0,
-        0,
-        0,
-        ANIMATION_DELAY_MS
-    );
-    m_Animation->SetForever();
-
-    m_Animator = new anim::FrameRangeAnimator();
-    m_Animator->SetOnAction(
-        [this](anim::Animator* animator, anim::Animation* animation)
-        {
-            auto* frameAnimator = static_cast<anim::FrameRangeAnimator*>(animator);
-            this->SetFrame(static_cast<byte>(frameAnimator->GetCurrFrame()));
-        }
-    );
 }
 
 Flower::~Flower()
 {
     StopAnimation();
-
-    if (m_Animation)
-    {
-        m_Animation->Destroy();
-        m_Animation = nullptr;
-    }
-
-    if (m_Animator)
-    {
-        m_Animator->Destroy();
-        m_Animator = nullptr;
-    }
 }
 
 void Flower::StartAnimation()
 {
-    if (m_Animator && m_Animation)
+    // Idle animation (loops forever), in step with every flower of the same film
+    if (!m_Clock)
     {
-        m_Animator->Start(m_Animation, core::SystemClock::Get().GetCurrTime());
+        unsigned endFrame = m_Film ? static_cast<unsigned>(m_Film->GetTotalFrames() - 1) : 0;
+        m_Clock = anim::FrameClock::Acquire(m_FilmId + ".anim", 0, endFrame, ANIMATION_DELAY_MS);
+        SetFrameClock(m_Clock);
     }
 }
 
 void Flower::StopAnimation()
 {
-    if (m_Animator)
+    if (m_Clock)
     {
-        m_Animator->Stop();
+        SetFrameClock(nullptr);
+        anim::FrameClock::Release(m_Clock);
+        m_Clock = nullptr;
     }
 }
@@ -2,8 +2,7 @@
 
 #include "Scene/Sprite.h"
 #include "Animations/AnimationFilm.h"
-#include "Animations/FrameRangeAnimation.h"
-#include "Animations/FrameRangeAnimator.h"
+#include "Animations/FrameClock.h"
 
 #include <string>
 
@@ -18,8 +17,8 @@ public:
 
 private:
     anim::AnimationFilm* m_Film = nullptr;
-    anim::FrameRangeAnimation* m_Animation = nullptr;
-    anim::FrameRangeAnimator* m_Animator = nullptr;
+    anim::FrameClock* m_Clock = nullptr;  // shared by every flower of this film
+    std::string m_FilmId;
 
     static constexpr unsigned ANIMATION_DELAY_MS = 400;
 };
@@ -14,6 +14,7 @@ public:
 
     void StartAnimation();
     void StopAnimation();
+    anim::Animator* GetAnimator() const { return m_Animator; }
     void Update();  // Call each frame to handle jump logic
     bool IsAlive() const { return m_IsAlive; }
     void Kill();    // Called when Sonic destroys the enemy
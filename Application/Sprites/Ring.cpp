@@ -33,44 +33,6 @@ Ring::Ring(int x, int y)
 
     // Setup bounding area for collision detection (16x16 ring)
     SetBoundingArea(new physics::BoundingBox(x, y, x + 16, y + 16));
-
-    // Create the spinning animation (loops forever)
-    m_SpinAnimation = new anim::FrameRangeAnimation(
-        "ring.spin.anim",
-        SPIN_START_FRAME,
-        SPIN_END_FRAME,
-        0,              // reps (0 for infinite with SetForever)
-        0,              // dx (no movement)
-        0,              // dy (no movement)
-        SPIN_DELAY_MS   // delay between frames
-    );
-    m_SpinAnimation->SetForever();
-
-    // Create the collected animation (plays once, faster)
-    m_CollectedAnimation = new anim::FrameRangeAnimation(
-        "ring.collected.anim",
-        COLLECTED_START_FRAME,
-        COLLECTED_END_FRAME,
-        1,                  // reps = 1 (play once)
-        0,                  // dx (no movement)
-        0,                  // dy (no movement)
-        COLLECTED_DELAY_MS  // faster delay for sparkle effect
-    );
-
-    // Create the animator
-    m_Animator = new anim::FrameRangeAnimator();
-
-    // Set the OnAction callback to update sprite frame
-    m_Animator->SetOnAction(
-        [this](anim::Animator* animator, anim::Animation* animation)
-        {
-            auto* frameAnimator = static_cast<anim::FrameRangeAnimator*>(animator);
-            this->SetFrame(static_cast<byte>(frameAnimator->GetCurrFrame()));
-        }
-    );
-
-    // Note: OnFinish callback is set in OnCollected() to avoid being triggered
-    // when stopping the spin animation (Stop() calls Finish() which triggers OnFinish)
 }
 
 Ring::~Ring()
@@ -78,12 +40,6 @@ Ring::~Ring()
     // Stop the animator first (must be stopped before it can be destroyed)
     StopAnimation();
 
-    if (m_SpinAnimation)
-    {
-        m_SpinAnimation->Destroy();
-        m_SpinAnimation = nullptr;
-    }
-
     if (m_CollectedAnimation)
     {
         m_CollectedAnimation->Destroy();
@@ -99,14 +55,22 @@ Ring::~Ring()
 
 void Ring::StartAnimation()
 {
-    if (m_Animator && m_SpinAnimation && !m_Collected)
+    if (!m_SpinClock && !m_Collected)
     {
-        m_Animator->Start(m_SpinAnimation, core::SystemClock::Get().GetCurrTime());
+        m_SpinClock = anim::FrameClock::Acquire("ring.spin.anim", SPIN_START_FRAME, SPIN_END_FRAME, SPIN_DELAY_MS);
+        SetFrameClock(m_SpinClock);
     }
 }
 
 void Ring::StopAnimation()
 {
+    if (m_SpinClock)
+    {
+        SetFrameClock(nullptr);
+        anim::FrameClock::Release(m_SpinClock);
+        m_SpinClock = nullptr;
+    }
+
     if (m_Animator)
     {
         m_Animator->Stop();
@@ -128,8 +92,27 @@ void Ring::OnCollected()
     m_FrameNo = 255;  // Force frame box update
     SetFrame(0);
 
-    // Set OnFinish callback NOW (after Stop has already triggered)
-    // This ensures we only hide the ring when the collected animation actually finishes
+    // Create the collected animation (plays once, faster)
+    m_CollectedAnimation = new anim::FrameRangeAnimation(
+        "ring.collected.anim",
+        COLLECTED_START_FRAME,
+        COLLECTED_END_FRAME,
+        1,                  // reps = 1 (play once)
+        0,                  // dx (no movement)
+        0,                  // dy (no movement)
+        COLLECTED_DELAY_MS  // faster delay for sparkle effect
+    );
+
+    m_Animator = new anim::FrameRangeAnimator();
+    m_Animator->SetOnAction(
+        [this](anim::Animator* animator, anim::Animation* animation)
+        {
+            auto* frameAnimator = static_cast<anim::FrameRangeAnimator*>(animator);
+            this->SetFrame(static_cast<byte>(frameAnimator->GetCurrFrame()));
+        }
+    );
+
+    // Hide the ring once the sparkle has played
     m_Animator->SetOnFinish(
         [this](anim::Animator* animator)
         {
@@ -139,10 +122,7 @@ void Ring::OnCollected()
     );
 
     // Start the collected animation (plays once then triggers OnFinish)
-    if (m_Animator && m_CollectedAnimation)
-    {
-        m_Animator->Start(m_CollectedAnimation, core::SystemClock::Get().GetCurrTime());
-    }
+    m_Animator->Start(m_CollectedAnimation, core::SystemClock::Get().GetCurrTime());
 
     // Play collection sound effect
     if (s_CollectSound)
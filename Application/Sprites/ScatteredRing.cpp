@@ -36,53 +36,12 @@ ScatteredRing::ScatteredRing(int x, int y, float velocityX, float velocityY)
 
     // Setup bounding area for collision detection (16x16 ring)
     SetBoundingArea(new physics::BoundingBox(x, y, x + 16, y + 16));
-
-    // Create the spinning animation (loops forever)
-    m_SpinAnimation = new anim::FrameRangeAnimation(
-        "scattered.ring.spin.anim",
-        SPIN_START_FRAME,
-        SPIN_END_FRAME,
-        0,              // reps (0 for infinite with SetForever)
-        0,              // dx (no movement)
-        0,              // dy (no movement)
-        SPIN_DELAY_MS   // delay between frames
-    );
-    m_SpinAnimation->SetForever();
-
-    // Create the collected animation (plays once, faster)
-    m_CollectedAnimation = new anim::FrameRangeAnimation(
-        "scattered.ring.collected.anim",
-        COLLECTED_START_FRAME,
-        COLLECTED_END_FRAME,
-        1,                  // reps = 1 (play once)
-        0,                  // dx (no movement)
-        0,                  // dy (no movement)
-        COLLECTED_DELAY_MS  // faster delay for sparkle effect
-    );
-
-    // Create the animator
-    m_Animator = new anim::FrameRangeAnimator();
-
-    // Set the OnAction callback to update sprite frame
-    m_Animator->SetOnAction(
-        [this](anim::Animator* animator, anim::Animation* animation)
-        {
-            auto* frameAnimator = static_cast<anim::FrameRangeAnimator*>(animator);
-            this->SetFrame(static_cast<byte>(frameAnimator->GetCurrFrame()));
-        }
-    );
 }
 
 ScatteredRing::~ScatteredRing()
 {
     StopAnimation();
 
-    if (m_SpinAnimation)
-    {
-        m_SpinAnimation->Destroy();
-        m_SpinAnimation = nullptr;
-    }
-
     if (m_CollectedAnimation)
     {
         m_CollectedAnimation->Destroy();
@@ -98,14 +57,23 @@ ScatteredRing::~ScatteredRing()
 
 void ScatteredRing::StartAnimation()
 {
-    if (m_Animator && m_SpinAnimation && !m_Collected)
+    // Same spin as the placed rings, so they share one clock
+    if (!m_SpinClock && !m_Collected)
     {
-        m_Animator->Start(m_SpinAnimation, core::SystemClock::Get().GetCurrTime());
+        m_SpinClock = anim::FrameClock::Acquire("ring.spin.anim", SPIN_START_FRAME, SPIN_END_FRAME, SPIN_DELAY_MS);
+        SetFrameClock(m_SpinClock);
     }
 }
 
 void ScatteredRing::StopAnimation()
 {
+    if (m_SpinClock)
+    {
+        SetFrameClock(nullptr);
+        anim::FrameClock::Release(m_SpinClock);
+        m_SpinClock = nullptr;
+    }
+
     if (m_Animator)
     {
         m_Animator->Stop();
@@ -197,7 +165,25 @@ void ScatteredRing::OnCollected()
     m_FrameNo = 255;
     SetFrame(0);
 
-    // Set OnFinish callback
+    // Create the collected animation (plays once, faster)
+    m_CollectedAnimation = new anim::FrameRangeAnimation(
+        "scattered.ring.collected.anim",
+        COLLECTED_START_FRAME,
+        COLLECTED_END_FRAME,
+        1,                  // reps = 1 (play once)
+        0,                  // dx (no movement)
+        0,                  // dy (no movement)
+        COLLECTED_DELAY_MS  // faster delay for sparkle effect
+    );
+
+    m_Animator = new anim::FrameRangeAnimator();
+    m_Animator->SetOnAction(
+        [this](anim::Animator* animator, anim::Animation* animation)
+        {
+            auto* frameAnimator = static_cast<anim::FrameRangeAnimator*>(animator);
+            this->SetFrame(static_cast<byte>(frameAnimator->GetCurrFrame()));
+        }
+    );
     m_Animator->SetOnFinish(
         [this](anim::Animator* animator)
         {
@@ -207,10 +193,7 @@ void ScatteredRing::OnCollected()
     );
 
     // Start the collected animation
-    if (m_Animator && m_CollectedAnimation)
-    {
-        m_Animator->Start(m_CollectedAnimation, core::SystemClock::Get().GetCurrTime());
-    }
+    m_Animator->Start(m_CollectedAnimation, core::SystemClock::Get().GetCurrTime());
 
     // Play collection sound effect
     if (s_CollectSound)
@@ -4,6 +4,7 @@
 #include "Animations/AnimationFilm.h"
 #include "Animations/FrameRangeAnimation.h"
 #include "Animations/FrameRangeAnimator.h"
+#include "Animations/FrameClock.h"
 #include "Sound/Sound.h"
 
 class ScatteredRing : public scene::Sprite
@@ -28,11 +29,11 @@ private:
     anim::AnimationFilm* m_SpinFilm = nullptr;
     anim::AnimationFilm* m_CollectedFilm = nullptr;
 
-    // Animations
-    anim::FrameRangeAnimation* m_SpinAnimation = nullptr;
-    anim::FrameRangeAnimation* m_CollectedAnimation = nullptr;
+    // Spin frames come from a clock shared by every ring
+    anim::FrameClock* m_SpinClock = nullptr;
 
-    // Animator (reused for both animations)
+    // Created on collection, the only animation this ring runs on its own
+    anim::FrameRangeAnimation* m_CollectedAnimation = nullptr;
     anim::FrameRangeAnimator* m_Animator = nullptr;
 
     // Physics state (floating point for smooth movement)
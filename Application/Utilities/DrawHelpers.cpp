@@ -1,6 +1,10 @@
 #include "Utilities/DrawHelpers.h"
 #include "Utilities/MenuConstants.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
 namespace draw
 {
     // Simple 5x7 pixel font for text (A-Z, 0-9, colon)
@@ -64,7 +68,7 @@ namespace draw
 
     void FilledRect(gfx::Bitmap screen, int x, int y, int w, int h, gfx::Color color)
     {
-        if (!gfx::BitmapLock(screen)) return;
+        if (!gfx::BitmapLockRect(screen, { x, y, w, h })) return;
 
         uint8_t* base = gfx::BitmapGetMemory(screen);
         int pitch = gfx::BitmapGetLineOffset(screen);
@@ -100,7 +104,7 @@ namespace draw
 
     void StoneButton(gfx::Bitmap screen, int x, int y, int w, int h, bool selected)
     {
-        if (!gfx::BitmapLock(screen)) return;
+        if (!gfx::BitmapLockRect(screen, { x, y, w, h })) return;
 
         uint8_t* base = gfx::BitmapGetMemory(screen);
         int pitch = gfx::BitmapGetLineOffset(screen);
@@ -164,7 +168,8 @@ namespace draw
     void Text(gfx::Bitmap screen, int x, int y, const char* text,
               gfx::Color color, int scale)
     {
-        if (!gfx::BitmapLock(screen)) return;
+        int textW = (int)std::strlen(text) * 6 * scale;
+        if (!gfx::BitmapLockRect(screen, { x, y, textW, 7 * scale })) return;
 
         uint8_t* base = gfx::BitmapGetMemory(screen);
         int pitch = gfx::BitmapGetLineOffset(screen);
@@ -205,7 +210,7 @@ namespace draw
 
     void Arrow(gfx::Bitmap screen, int x, int y, gfx::Color color)
     {
-        if (!gfx::BitmapLock(screen)) return;
+        if (!gfx::BitmapLockRect(screen, { x, y, 5, 10 })) return;
 
         uint8_t* base = gfx::BitmapGetMemory(screen);
         int pitch = gfx::BitmapGetLineOffset(screen);
@@ -225,4 +230,44 @@ namespace draw
 
         gfx::BitmapUnlock(screen);
     }
+
+    void ProfilerOverlay(gfx::Bitmap screen, int x, int y, const core::FrameProfiler& profiler)
+    {
+        constexpr int ROW_H = 10;
+        constexpr int BAR_X = 29 * 6 + 6;     // after the text columns
+        constexpr int BAR_W = 60;
+        constexpr uint64_t BUDGET_US = 16667; // one 60 Hz frame fills the bar
+
+        const int rows = int(core::FrameProfiler::PHASES) + 1;
+        gfx::BitmapFillRectBlended(screen, { x, y, BAR_X + BAR_W + 8, rows * ROW_H + 6 },
+                                   gfx::MakeColor(0, 0, 0, 255), 176);
+
+        gfx::Color white = gfx::MakeColor(255, 255, 255, 255);
+        Text(screen, x + 4, y + 3, "PHASE US      AVG   P99   MAX", white);
+
+        char line[64];
+        for (size_t i = 0; i < core::FrameProfiler::PHASES; ++i)
+        {
+            auto phase = core::FramePhase(i);
+            core::PhaseStats st = profiler.GetStats(phase);
+            uint64_t avg = st.avg / 1000, p99 = st.p99 / 1000, max = st.max / 1000;
+
+            std::snprintf(line, sizeof(line), "%-11s%6llu%6llu%6llu",
+                          core::FrameProfiler::GetPhaseName(phase),
+                          (unsigned long long)avg, (unsigned long long)p99, (unsigned long long)max);
+
+            int rowY = y + 3 + int(i + 1) * ROW_H;
+            bool total = phase == core::FramePhase::Total;
+            Text(screen, x + 4, rowY, line, total ? gfx::MakeColor(255, 255, 0, 255) : white);
+
+            // Avg as a solid bar, p99 as a tick past it
+            int avgW = int(std::min<uint64_t>(avg * BAR_W / BUDGET_US, BAR_W));
+            int p99X = int(std::min<uint64_t>(p99 * BAR_W / BUDGET_US, BAR_W - 1));
+            gfx::Color barColor = p99 >= BUDGET_US ? gfx::MakeColor(255, 64, 64, 255)
+                                                   : gfx::MakeColor(64, 200, 64, 255);
+            if (avgW > 0)
+                FilledRect(screen, x + BAR_X, rowY, avgW, 7, barColor);
+            FilledRect(screen, x + BAR_X + p99X, rowY, 1, 7, white);
+        }
+    }
 }
@@ -2,6 +2,7 @@
 
 #include "Rendering/Bitmap.h"
 #include "Rendering/Color.h"
+#include "Core/FrameProfiler.h"
 
 #include <cstdint>
 
@@ -33,4 +34,7 @@ namespace draw
 
     // Draw a selection arrow (pointing right)
     void Arrow(gfx::Bitmap screen, int x, int y, gfx::Color color);
+
+    // Draw per-phase avg/p99/max (microseconds) with a bar against a 60 Hz frame
+    void ProfilerOverlay(gfx::Bitmap screen, int x, int y, const core::FrameProfiler& profiler);
 }
@@ -12,6 +12,7 @@ namespace anim
 
 	void AnimationFilmHolder::Load(const std::string& text, const EntryParser& entryParser)
 	{
+		std::list<AnimationFilm::Data> output;
 		int pos = 0;
 		while (true)
 		{
@@ -20,17 +21,20 @@ namespace anim
 			auto i = entryParser(pos, text, id, path, rects);
 			ASSERT(i >= 0, "Failed. No insert in the animation film Holder!");
 			if (!i)
-				return;
+				break;
 			pos += i;
-			ASSERT(!GetFilm(id), "Failed. Film already inserted in animation film holder!");
 
 			// Convert Rects to FrameData (no offset for legacy parsers)
-			std::vector<AnimationFilm::FrameData> frames;
+			AnimationFilm::Data entry;
+			entry.id = id;
+			entry.path = path;
 			for (const auto& r : rects)
-				frames.push_back({ r, {0, 0} });
+				entry.frames.push_back({ r, {0, 0} });
 
-			m_Films[id] = new AnimationFilm(m_Bitmaps.Load(path), frames, id);
+			output.push_back(std::move(entry));
 		}
+
+		Insert(output);
 	}
 
 	void AnimationFilmHolder::Load(const std::string& text, const FullParser& parser)
@@ -39,7 +43,15 @@ namespace anim
 		auto result = parser(output, text);
 		ASSERT(result, "Failed. Parser provided in Animation Film holder return invalid Result");
 
-		for (auto& entry : output)
+		Insert(output);
+	}
+
+	void AnimationFilmHolder::Insert(std::list<AnimationFilm::Data>& entries)
+	{
+		auto& atlas = m_Atlases.emplace_back();
+		std::vector<std::vector<AtlasPacker::EntryId>> frameIds;
+
+		for (auto& entry : entries)
 		{
 			ASSERT(!GetFilm(entry.id), "Failed. Film already inserted in animation film holder!");
 			Bitmap bmp = m_Bitmaps.Load(entry.path);
@@ -50,8 +62,30 @@ namespace anim
 				BitmapSetColorKey(bmp, entry.colorKey.r, entry.colorKey.g, entry.colorKey.b);
 			}
 
-			m_Films[entry.id] = new AnimationFilm(bmp, entry.frames, entry.id);
+			// Each film is its own group so all of its frames share a page
+			auto& ids = frameIds.emplace_back();
+			for (auto& frame : entry.frames)
+				ids.push_back(atlas.Add(bmp, frame.rect, (Index)(frameIds.size() - 1)));
+		}
+
+		atlas.Build();
+
+		auto ids = frameIds.begin();
+		for (auto& entry : entries)
+		{
+			Bitmap page = nullptr;
+			for (size_t i = 0; i < entry.frames.size(); ++i)
+			{
+				page = atlas.GetPage((*ids)[i]);
+				entry.frames[i].rect = atlas.GetRect((*ids)[i]);
+			}
+			++ids;
+
+			m_Films[entry.id] = new AnimationFilm(page, entry.frames, entry.id);
 		}
+
+		// Sheets are no longer referenced, only the packed frames are kept
+		m_Bitmaps.CleanUp();
 	}
 
 	void AnimationFilmHolder::CleanUp(void)
@@ -59,6 +93,7 @@ namespace anim
 		for (auto& i : m_Films)
 			delete (i.second);
 		m_Films.clear();
+		m_Atlases.clear();
 	}
 
 	auto AnimationFilmHolder::GetFilm(const std::string& id) -> const AnimationFilm* const
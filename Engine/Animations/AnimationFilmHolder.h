@@ -2,6 +2,7 @@
 
 #include "Animations/AnimationFilm.h"
 #include "Rendering/Bitmap.h"
+#include "Rendering/AtlasPacker.h"
 
 #include <list>
 #include <string>
@@ -35,10 +36,13 @@ namespace anim
 	private:
 		using Films = std::map<std::string, AnimationFilm*>;
 
+		void Insert(std::list<AnimationFilm::Data>& entries);
+
 		static AnimationFilmHolder s_Holder; // singleton
 
 		Films m_Films;
 		BitmapLoader m_Bitmaps;			   // only for loading of film bitmaps
+		std::list<AtlasPacker> m_Atlases;  // film frames repacked per Load call
 
 		AnimationFilmHolder(void) {}
 		~AnimationFilmHolder() { CleanUp(); }
@@ -13,6 +13,41 @@ namespace anim
 		return m_State != ANIMATOR_RUNNING;
 	}
 
+	void Animator::Sleep(TimeStamp t)
+	{
+		if (!HasFinished() && !m_IsAsleep)
+		{
+			m_IsAsleep = true;
+			m_SleepTime = t;
+			AnimatorManager::Get().MarkAsSleeping(this);
+		}
+	}
+
+	void Animator::Wake(TimeStamp t)
+	{
+		if (m_IsAsleep)
+		{
+			m_IsAsleep = false;
+			TimeShift(t - m_SleepTime);
+			AnimatorManager::Get().MarkAsAwake(this);
+		}
+	}
+
+	bool Animator::IsAsleep(void) const
+	{
+		return m_IsAsleep;
+	}
+
+	TimeStamp Animator::GetNextDue(void) const
+	{
+		return 0;
+	}
+
+	TimeStamp Animator::DueAfter(unsigned delay) const
+	{
+		return m_LastTime + (delay ? delay : 1);
+	}
+
 	void Animator::TimeShift(TimeStamp offset)
 	{
 		m_LastTime += offset;
@@ -45,6 +80,7 @@ namespace anim
 
 	void Animator::NotifyStopped(void)
 	{
+		m_IsAsleep = false;
 		AnimatorManager::Get().MarkAsSuspended(this);
 		if (m_OnFinish)
 			(m_OnFinish)(this);
@@ -52,6 +88,7 @@ namespace anim
 
 	void Animator::NotifyStarted(void)
 	{
+		m_IsAsleep = false;
 		AnimatorManager::Get().MarkAsRunning(this);
 		if (m_OnStart)
 			(m_OnStart)(this);
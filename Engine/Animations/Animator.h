@@ -29,9 +29,19 @@ namespace anim
 		void Stop(void);
 		bool HasFinished(void) const;
 
+		// Parks a running animator off the manager's progress list without
+		// finishing it; Wake shifts it by the time slept so it resumes in place
+		void Sleep(TimeStamp t);
+		void Wake(TimeStamp t);
+		bool IsAsleep(void) const;
+
 		virtual void TimeShift(TimeStamp offset);
 		virtual void Progress(TimeStamp currTime) = 0;
 
+		// Earliest time a Progress call can change anything; the manager leaves
+		// the animator alone until then. By default it is progressed every frame.
+		virtual TimeStamp GetNextDue(void) const;
+
 		void SetOnFinish(const OnFinish& f);
 		void SetOnAction(const OnAction& f);
 		void SetOnStart(const OnStart& f);
@@ -47,9 +57,15 @@ namespace anim
 		void NotifyAction(Animation*);
 		void Finish(bool isForced = false);
 
+		// Due time of a discrete step of `delay` ms after m_LastTime, matching
+		// the `currTime > m_LastTime && currTime - m_LastTime >= delay` loops
+		TimeStamp DueAfter(unsigned delay) const;
+
 	protected:
 		TimeStamp m_LastTime = 0;
 		animatorstate_t m_State = ANIMATOR_FINISHED;
+		TimeStamp m_SleepTime = 0;
+		bool m_IsAsleep = false;
 		OnFinish m_OnFinish;
 		OnStart m_OnStart;
 		OnAction m_OnAction;
@@ -2,6 +2,8 @@
 #include "Animations/Animator.h"
 #include "Utils/Assert.h"
 
+#include <algorithm>
+
 namespace anim
 {
 	AnimatorManager AnimatorManager::s_AnimatorManager;
@@ -22,28 +24,97 @@ namespace anim
 	{
 		ASSERT(!a->HasFinished(), "FAILED. Animator is allready running");
 		m_Suspended.erase(a);
-		m_Running.insert(a);
+		m_Sleeping.erase(a);
+		Schedule(a);
 	}
 
 	void AnimatorManager::MarkAsSuspended(Animator* a)
 	{
 		ASSERT(a->HasFinished(), "FAILED. Animator has not finished yet");
 		m_Running.erase(a);
+		m_Sleeping.erase(a);
 		m_Suspended.insert(a);
 	}
 
+	void AnimatorManager::MarkAsSleeping(Animator* a)
+	{
+		ASSERT(!a->HasFinished() && a->IsAsleep(), "FAILED. Only a running animator can sleep");
+		m_Running.erase(a);
+		m_Sleeping.insert(a);
+	}
+
+	void AnimatorManager::MarkAsAwake(Animator* a)
+	{
+		ASSERT(!a->HasFinished() && !a->IsAsleep(), "FAILED. Animator is not waking up");
+		m_Sleeping.erase(a);
+		Schedule(a);
+	}
+
 	void AnimatorManager::Progress(TimeStamp currTime)
 	{
-		auto copied(m_Running);
-		for (auto* a : copied)
-			a->Progress(currTime);
+		m_IsProgressing = true;
+		while (!m_Queue.empty() && m_Queue.front().due <= currTime)
+		{
+			std::pop_heap(m_Queue.begin(), m_Queue.end());
+			Scheduled s = m_Queue.back();
+			m_Queue.pop_back();
+
+			auto i = m_Running.find(s.animator);
+			if (i == m_Running.end() || i->second != s.ticket)
+				continue;	// retired since it was queued
+
+			s.animator->Progress(currTime);
+
+			// Still on the same ticket means it neither finished nor restarted
+			i = m_Running.find(s.animator);
+			if (i != m_Running.end() && i->second == s.ticket)
+				m_Deferred.emplace_back(s.animator, s.ticket);
+		}
+		m_IsProgressing = false;
+
+		for (auto& [a, ticket] : m_Deferred)
+		{
+			auto i = m_Running.find(a);
+			if (i != m_Running.end() && i->second == ticket)
+				Push(a, ticket);
+		}
+		m_Deferred.clear();
+
+		// Frequent restarts leave retired entries behind until they come due
+		if (m_Queue.size() > 2 * m_Running.size() + 64)
+			Rebuild();
 	}
 
 	void AnimatorManager::TimeShift(TimeStamp dt)
 	{
-		auto copied(m_Running);
-		for (auto* a : copied)
+		ASSERT(!m_IsProgressing, "FAILED. Time shift while progressing animators");
+		for (auto& [a, ticket] : m_Running)
 			a->TimeShift(dt);
+		Rebuild();
+	}
+
+	void AnimatorManager::Schedule(Animator* a)
+	{
+		uint64_t ticket = ++m_NextTicket;
+		m_Running[a] = ticket;
+		if (m_IsProgressing)
+			m_Deferred.emplace_back(a, ticket);
+		else
+			Push(a, ticket);
+	}
+
+	void AnimatorManager::Push(Animator* a, uint64_t ticket)
+	{
+		m_Queue.push_back({ a->GetNextDue(), ticket, a });
+		std::push_heap(m_Queue.begin(), m_Queue.end());
+	}
+
+	void AnimatorManager::Rebuild(void)
+	{
+		m_Queue.clear();
+		for (auto& [a, ticket] : m_Running)
+			m_Queue.push_back({ a->GetNextDue(), ticket, a });
+		std::make_heap(m_Queue.begin(), m_Queue.end());
 	}
 
 	auto AnimatorManager::Get(void) -> AnimatorManager&
@@ -2,12 +2,20 @@
 
 #include "Utils/Common.h"
 
+#include <cstdint>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 namespace anim
 {
 	class Animator;
 
+	// Running animators wait in a min-heap keyed on their next due time, so a
+	// frame only touches the ones with a step to take. Each schedule carries a
+	// ticket; restarting, suspending or cancelling an animator just retires its
+	// ticket and the stale heap entry is dropped when it surfaces. Animators
+	// (re)started while Progress runs are queued and scheduled after it.
 	class AnimatorManager final
 	{
 	public:
@@ -16,19 +24,42 @@ namespace anim
 
 		void MarkAsRunning(Animator* a);
 		void MarkAsSuspended(Animator* a);
+		void MarkAsSleeping(Animator* a);
+		void MarkAsAwake(Animator* a);
 
 		void Progress(TimeStamp currTime);
 		void TimeShift(TimeStamp dt);
 
 		static auto Get(void) -> AnimatorManager&;
 
+	private:
+		struct Scheduled
+		{
+			TimeStamp due;
+			uint64_t  ticket;
+			Animator* animator;
+
+			// Inverted so the std heap algorithms keep the earliest on top
+			bool operator<(const Scheduled& o) const { return due != o.due ? due > o.due : ticket > o.ticket; }
+		};
+
+		void Schedule(Animator* a);
+		void Push(Animator* a, uint64_t ticket);
+		void Rebuild(void);
+
 	private:
 		static AnimatorManager s_AnimatorManager;
 
-		std::set<Animator*> m_Running, m_Suspended;
+		std::unordered_map<Animator*, uint64_t> m_Running;	// animator -> live ticket
+		std::set<Animator*> m_Suspended, m_Sleeping;
+
+		std::vector<Scheduled> m_Queue;
+		std::vector<std::pair<Animator*, uint64_t>> m_Deferred;
+		uint64_t m_NextTicket = 0;
+		bool m_IsProgressing = false;
 
 		AnimatorManager(void) = default;
 		AnimatorManager(const AnimatorManager&) = delete;
 		AnimatorManager(AnimatorManager&&) = delete;
 	};
-}
\ No newline at end of file
+}
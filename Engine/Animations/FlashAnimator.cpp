@@ -27,6 +27,11 @@ namespace anim
 		}
 	}
 
+	TimeStamp FlashShowAnimator::GetNextDue(void) const
+	{
+		return DueAfter(m_Anim->GetShowDelay());
+	}
+
 	unsigned FlashShowAnimator::GetShowDelay(void) const
 	{
 		return m_ShowDelay;
@@ -66,6 +71,11 @@ namespace anim
 		}
 	}
 
+	TimeStamp FlashHideAnimator::GetNextDue(void) const
+	{
+		return DueAfter(m_Anim->GetHideDelay());
+	}
+
 	unsigned FlashHideAnimator::GetHideDelay(void) const
 	{
 		return m_HideDelay;
@@ -10,6 +10,7 @@ namespace anim
 	{
 	public:
 		virtual void Progress(TimeStamp currtime) override;
+		virtual TimeStamp GetNextDue(void) const override;
 		unsigned GetShowDelay(void) const;
 		unsigned GetCurrRep(void) const;
 		auto GetAnim(void) const -> const FlashAnimation&;
@@ -28,6 +29,7 @@ namespace anim
 	{
 	public:
 		virtual void Progress(TimeStamp currtime) override;
+		virtual TimeStamp GetNextDue(void) const override;
 		unsigned GetHideDelay(void) const;
 		unsigned GetCurrRep(void) const;
 		auto GetAnim(void) const -> const FlashAnimation&;
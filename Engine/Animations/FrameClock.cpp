@@ -0,0 +1,60 @@
+#include "Animations/FrameClock.h"
+#include "Animations/FrameRangeAnimation.h"
+#include "Animations/FrameRangeAnimator.h"
+#include "Core/SystemClock.h"
+#include "Utils/Assert.h"
+
+namespace anim
+{
+	FrameClock::Clocks FrameClock::s_Clocks;
+
+	auto FrameClock::Acquire(const std::string& id, unsigned startFrame, unsigned endFrame, unsigned delay) -> FrameClock*
+	{
+		auto i = s_Clocks.find(id);
+		if (i == s_Clocks.end())
+			i = s_Clocks.emplace(id, new FrameClock(id, startFrame, endFrame, delay)).first;
+
+		FrameClock* clock = i->second;
+		ASSERT(clock->m_Anim->GetStartFrame() == startFrame && clock->m_Anim->GetEndFrame() == endFrame && clock->m_Anim->GetDelay() == delay,
+			"FAILED. Frame clock acquired again with a different frame range");
+		++clock->m_Users;
+		return clock;
+	}
+
+	void FrameClock::Release(FrameClock* clock)
+	{
+		ASSERT(clock && clock->m_Users, "FAILED. Frame clock released more times than acquired");
+		if (--clock->m_Users == 0)
+		{
+			s_Clocks.erase(clock->m_Id);
+			delete clock;
+		}
+	}
+
+	byte FrameClock::GetCurrFrame(void) const
+	{
+		return static_cast<byte>(m_Animator->GetCurrFrame());
+	}
+
+	auto FrameClock::GetId(void) const -> const std::string&
+	{
+		return m_Id;
+	}
+
+	FrameClock::FrameClock(const std::string& id, unsigned startFrame, unsigned endFrame, unsigned delay)
+		:	m_Id(id)
+	{
+		m_Anim = new FrameRangeAnimation(id, startFrame, endFrame, 0, 0, 0, delay);
+		m_Anim->SetForever();
+
+		m_Animator = new FrameRangeAnimator();
+		m_Animator->Start(m_Anim, core::SystemClock::Get().GetCurrTime());
+	}
+
+	FrameClock::~FrameClock()
+	{
+		m_Animator->Stop();
+		m_Animator->Destroy();
+		m_Anim->Destroy();
+	}
+}
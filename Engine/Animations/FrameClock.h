@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Utils/Common.h"
+
+#include <map>
+#include <string>
+
+namespace anim
+{
+	class FrameRangeAnimation;
+	class FrameRangeAnimator;
+
+	// A looping frame range run by a single animator on behalf of every sprite
+	// that shows it in lockstep (spinning rings, swaying flowers). Sprites read
+	// the current frame from the clock instead of each owning an animation and
+	// an animator; those are only needed for one-off states such as "collected".
+	class FrameClock final
+	{
+	public:
+		// Clocks are shared by id. The first Acquire starts it at the current
+		// SystemClock time, the last Release stops and destroys it.
+		static auto Acquire(const std::string& id, unsigned startFrame, unsigned endFrame, unsigned delay) -> FrameClock*;
+		static void Release(FrameClock* clock);
+
+		byte GetCurrFrame(void) const;
+		auto GetId(void) const -> const std::string&;
+
+	private:
+		using Clocks = std::map<std::string, FrameClock*>;
+
+		FrameClock(const std::string& id, unsigned startFrame, unsigned endFrame, unsigned delay);
+		~FrameClock();
+		FrameClock(const FrameClock&) = delete;
+		FrameClock(FrameClock&&) = delete;
+
+	private:
+		static Clocks s_Clocks;
+
+		std::string m_Id;
+		FrameRangeAnimation* m_Anim = nullptr;
+		FrameRangeAnimator* m_Animator = nullptr;
+		unsigned m_Users = 0;
+	};
+}
@@ -36,6 +36,11 @@ namespace anim
 		}
 	}
 
+	TimeStamp FrameListAnimator::GetNextDue(void) const
+	{
+		return DueAfter(m_Anim->GetDelay());
+	}
+
 	unsigned FrameListAnimator::GetCurrFrame(void) const
 	{
 		return m_CurrFrame;
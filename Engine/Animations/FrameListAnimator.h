@@ -10,6 +10,7 @@ namespace anim
 	{
 	public:
 		virtual void Progress(TimeStamp currtime) override;
+		virtual TimeStamp GetNextDue(void) const override;
 		unsigned GetCurrFrame(void) const;
 		unsigned GetCurrRep(void) const;
 		auto GetAnim(void) const -> const FrameListAnimation&;
@@ -33,6 +33,11 @@ namespace anim
 		}
 	}
 
+	TimeStamp FrameRangeAnimator::GetNextDue(void) const
+	{
+		return DueAfter(m_Anim->GetDelay());
+	}
+
 	unsigned FrameRangeAnimator::GetCurrFrame(void) const
 	{
 		return m_CurrFrame;
@@ -10,6 +10,7 @@ namespace anim
 	{
 	public:
 		virtual void Progress(TimeStamp currTime) override;
+		virtual TimeStamp GetNextDue(void) const override;
 
 		unsigned GetCurrFrame(void) const;
 		unsigned GetPrevFrame(void) const;
@@ -22,6 +22,11 @@ namespace anim
 		}
 	}
 
+	TimeStamp MovingAnimator::GetNextDue(void) const
+	{
+		return DueAfter(m_Anim->GetDelay());
+	}
+
 	void MovingAnimator::ProgressContinuous(TimeStamp currTime)
 	{
 		auto vx = float(m_Anim->GetDx()) / float(m_Anim->GetDelay());
@@ -10,6 +10,7 @@ namespace anim
 	{
 	public:
 		virtual void Progress(TimeStamp currTime) override;
+		virtual TimeStamp GetNextDue(void) const override;
 		virtual void ProgressContinuous(TimeStamp currTime);
 		auto GetAnim(void) const -> const MovingAnimation&;
 
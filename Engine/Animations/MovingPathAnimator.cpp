@@ -23,6 +23,11 @@ namespace anim
 		}
 	}
 
+	TimeStamp MovingPathAnimator::GetNextDue(void) const
+	{
+		return DueAfter(m_Anim->GetPath().at(m_CurrPath).delay);
+	}
+
 	unsigned MovingPathAnimator::GetCurrRep(void) const
 	{
 		return m_CurrRep;
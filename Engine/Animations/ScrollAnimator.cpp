@@ -23,6 +23,11 @@ namespace anim
 		}
 	}
 
+	TimeStamp ScrollAnimator::GetNextDue(void) const
+	{
+		return DueAfter(m_Anim->GetScroll().at(m_CurrScroll).delay);
+	}
+
 	unsigned ScrollAnimator::GetCurrRep(void) const
 	{
 		return m_CurrRep;
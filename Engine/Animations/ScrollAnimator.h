@@ -9,6 +9,7 @@ namespace anim
 	class ScrollAnimator : public Animator
 	{
 		virtual void Progress(Time currtime) override;
+		virtual TimeStamp GetNextDue(void) const override;
 
 		unsigned GetCurrRep(void) const;
 		unsigned GetCurrScroll(void) const;
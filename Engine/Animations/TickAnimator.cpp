@@ -31,6 +31,12 @@ namespace anim
 			}
 	}
 
+	TimeStamp TickAnimator::GetNextDue(void) const
+	{
+		// Continuous ticks report the elapsed time every frame
+		return m_Anim->IsDiscrete() ? DueAfter(m_Anim->GetDelay()) : Animator::GetNextDue();
+	}
+
 	unsigned TickAnimator::GetCurrRep(void) const
 	{
 		return m_CurrRep;
@@ -10,6 +10,7 @@ namespace anim
 	{
 	public:
 		virtual void Progress(TimeStamp currTime) override;
+		virtual TimeStamp GetNextDue(void) const override;
 
 		unsigned GetCurrRep(void) const;
 		unsigned GetElapsedTime(void) const;
@@ -30,7 +30,7 @@ namespace anim
 		// Time-based progression (roughly 60fps assumption)
 		// We advance by m_CurrentSpeed pixels per ~16ms
 		TimeStamp elapsed = currTime - m_LastTime;
-		if (elapsed < 16) // Cap at ~60fps update rate
+		if (elapsed < PROGRESS_STEP_MS) // Cap at ~60fps update rate
 			return;
 
 		m_LastTime = currTime;
@@ -76,6 +76,11 @@ namespace anim
 		}
 	}
 
+	TimeStamp TunnelPathAnimator::GetNextDue(void) const
+	{
+		return m_LastTime + PROGRESS_STEP_MS;
+	}
+
 	Point TunnelPathAnimator::GetCurrentPosition() const
 	{
 		return InterpolatePosition();
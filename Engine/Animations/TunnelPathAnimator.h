@@ -10,6 +10,7 @@ namespace anim
 	{
 	public:
 		virtual void Progress(TimeStamp currTime) override;
+		virtual TimeStamp GetNextDue(void) const override;
 
 		void Start(const TunnelPath* path, TimeStamp t);
 
@@ -29,6 +30,8 @@ namespace anim
 		TunnelPathAnimator();
 
 	private:
+		static constexpr TimeStamp PROGRESS_STEP_MS = 16;	// ~60fps update rate
+
 		// Interpolate position based on current distance traveled
 		Point InterpolatePosition() const;
 
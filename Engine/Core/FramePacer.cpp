@@ -0,0 +1,103 @@
+#include "Core/FramePacer.h"
+#include "Core/SystemClock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace core
+{
+	void FramePacer::SetTargetRate(unsigned hz)
+	{
+		m_PeriodUs = hz ? 1000000 / hz : 0;
+		Reset();
+	}
+
+	unsigned FramePacer::GetTargetRate(void) const
+	{
+		return m_PeriodUs ? unsigned(1000000 / m_PeriodUs) : 0;
+	}
+
+	void FramePacer::SetVSyncLocked(bool v)
+	{
+		m_VSyncLocked = v;
+		Reset();
+	}
+
+	bool FramePacer::IsVSyncLocked(void) const
+	{
+		return m_VSyncLocked;
+	}
+
+	void FramePacer::Pace(void)
+	{
+		if (!m_PeriodUs)
+			return;
+
+		auto& clock = SystemClock::Get();
+		Time now = clock.micro_secs();
+
+		if (!m_FrameStart)
+		{
+			m_FrameStart = now;
+			m_Deadline = now + m_PeriodUs;
+			return;
+		}
+
+		m_WorkTime = now - m_FrameStart;
+		if (!m_VSyncLocked || m_WorkTime < m_PeriodUs / 2)
+			WaitUntil(m_Deadline);
+
+		now = clock.micro_secs();
+		m_FrameTime = now - m_FrameStart;
+		m_FrameStart = now;
+
+		// Keep the deadlines on a fixed grid so a slightly late frame is made
+		// up by the next one, unless we fell a whole period behind
+		m_Deadline += m_PeriodUs;
+		if (m_VSyncLocked || now >= m_Deadline)
+			m_Deadline = now + m_PeriodUs;
+	}
+
+	void FramePacer::Reset(void)
+	{
+		m_FrameStart = 0;
+		m_Deadline = 0;
+		m_FrameTime = 0;
+		m_WorkTime = 0;
+	}
+
+	Time FramePacer::GetFrameTime(void) const
+	{
+		return m_FrameTime;
+	}
+
+	Time FramePacer::GetWorkTime(void) const
+	{
+		return m_WorkTime;
+	}
+
+	void FramePacer::WaitUntil(Time deadline)
+	{
+		auto& clock = SystemClock::Get();
+		Time now = clock.micro_secs();
+		if (now >= deadline)
+			return;
+
+		if (deadline - now > m_SpinUs)
+		{
+			Time sleep = deadline - now - m_SpinUs;
+			std::this_thread::sleep_for(std::chrono::microseconds(sleep));
+
+			// Widen the spin window at once when the OS wakes us late,
+			// narrow it slowly while it is early enough
+			Time slept = clock.micro_secs() - now;
+			Time late = slept > sleep ? slept - sleep : 0;
+			Time wanted = std::clamp(late + MIN_SPIN_US, MIN_SPIN_US, MAX_SPIN_US);
+			m_SpinUs = wanted > m_SpinUs ? wanted : m_SpinUs - (m_SpinUs - wanted) / 16;
+		}
+
+		while (clock.micro_secs() < deadline)
+			std::this_thread::yield();
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Utils/Common.h"
+
+namespace core
+{
+	// Holds the main loop to a target frame rate against fixed deadlines:
+	// only the time the frame's work left over is slept, and the last stretch
+	// is spun so the deadline is hit to within a few microseconds. The spin
+	// window adapts to how late the OS wakes us from sleep. Short overruns are
+	// paid back on the next frame; anything longer than a period resyncs.
+	class FramePacer final
+	{
+	public:
+		// 0 turns pacing off
+		void SetTargetRate(unsigned hz);
+		unsigned GetTargetRate(void) const;
+		bool IsEnabled(void) const { return m_PeriodUs != 0; }
+
+		// With vsync on in the renderer (gfx::SetVSync), present already
+		// blocks on the display; the pacer then only measures, and paces
+		// itself only when a frame returns implausibly fast (e.g. minimized)
+		void SetVSyncLocked(bool v);
+		bool IsVSyncLocked(void) const;
+
+		// Once per frame, after the frame has been presented
+		void Pace(void);
+		void Reset(void);
+
+		Time GetFrameTime(void) const;	// us between the last two Pace calls
+		Time GetWorkTime(void) const;	// us of the last frame spent before Pace
+
+	private:
+		void WaitUntil(Time deadline);
+
+	private:
+		static constexpr Time MIN_SPIN_US = 200;
+		static constexpr Time MAX_SPIN_US = 4000;
+
+		Time m_PeriodUs = 0;
+		Time m_Deadline = 0;
+		Time m_FrameStart = 0;		// 0 until the first Pace
+		Time m_FrameTime = 0;
+		Time m_WorkTime = 0;
+		Time m_SpinUs = 1000;
+		bool m_VSyncLocked = false;
+	};
+}
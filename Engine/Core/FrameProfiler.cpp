@@ -0,0 +1,116 @@
+#include "Core/FrameProfiler.h"
+#include "Core/SystemClock.h"
+
+#include <algorithm>
+
+namespace core
+{
+	void FrameProfiler::SetEnabled(bool v)
+	{
+		m_Enabled = v;
+		m_Current.fill(0);
+		m_FrameStart = 0;
+	}
+
+	void FrameProfiler::SetOverlayVisible(bool v)
+	{
+		m_OverlayVisible.store(v, std::memory_order_relaxed);
+	}
+
+	void FrameProfiler::ToggleOverlay(void)
+	{
+		SetOverlayVisible(!IsOverlayVisible());
+	}
+
+	bool FrameProfiler::IsOverlayVisible(void) const
+	{
+		return m_OverlayVisible.load(std::memory_order_relaxed);
+	}
+
+	void FrameProfiler::EndFrame(void)
+	{
+		if (!m_Enabled)
+			return;
+
+		Time now = SystemClock::Get().nano_secs();
+		bool first = !m_FrameStart;
+		m_Current[size_t(FramePhase::Total)] = now - m_FrameStart;
+		m_FrameStart = now;
+
+		// The first frame has no start to measure from
+		if (!first)
+		{
+			uint64_t n = m_Written.load(std::memory_order_relaxed);
+			Slot& slot = m_Ring[n % HISTORY];
+
+			uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+			slot.seq.store(seq + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			for (size_t i = 0; i < PHASES; ++i)
+				slot.ns[i].store(m_Current[i], std::memory_order_relaxed);
+			slot.seq.store(seq + 2, std::memory_order_release);
+
+			m_Written.store(n + 1, std::memory_order_release);
+		}
+
+		m_Current.fill(0);
+	}
+
+	PhaseStats FrameProfiler::GetStats(FramePhase phase) const
+	{
+		std::array<Time, HISTORY> samples;
+		size_t count = 0;
+
+		uint64_t written = m_Written.load(std::memory_order_acquire);
+		uint64_t frames = std::min<uint64_t>(written, HISTORY);
+		for (uint64_t n = written - frames; n < written; ++n)
+		{
+			const Slot& slot = m_Ring[n % HISTORY];
+			uint32_t seq = slot.seq.load(std::memory_order_acquire);
+			if (seq & 1)
+				continue;
+
+			Time ns = slot.ns[size_t(phase)].load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (slot.seq.load(std::memory_order_relaxed) != seq)
+				continue;
+
+			samples[count++] = ns;
+		}
+
+		PhaseStats stats;
+		if (!count)
+			return stats;
+
+		Time sum = 0;
+		stats.min = stats.max = samples[0];
+		for (size_t i = 0; i < count; ++i)
+		{
+			sum += samples[i];
+			stats.min = std::min(stats.min, samples[i]);
+			stats.max = std::max(stats.max, samples[i]);
+		}
+		stats.avg = sum / count;
+		stats.frames = unsigned(count);
+
+		// Nearest-rank 99th percentile
+		size_t rank = (count * 99 + 99) / 100 - 1;
+		std::nth_element(samples.begin(), samples.begin() + rank, samples.begin() + count);
+		stats.p99 = samples[rank];
+		return stats;
+	}
+
+	uint64_t FrameProfiler::GetFrameCount(void) const
+	{
+		return m_Written.load(std::memory_order_acquire);
+	}
+
+	const char* FrameProfiler::GetPhaseName(FramePhase phase)
+	{
+		static const char* names[PHASES] = {
+			"RENDER", "INPUT", "ANIMATIONS", "AI", "PHYSICS",
+			"COLLISIONS", "SCRIPTING", "DESTRUCTION", "PACING", "TOTAL"
+		};
+		return phase < FramePhase::Count ? names[size_t(phase)] : "";
+	}
+}
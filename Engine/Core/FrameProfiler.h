@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Utils/Common.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace core
+{
+	enum class FramePhase : unsigned
+	{
+		Render = 0,
+		Input,
+		Animations,
+		AI,
+		Physics,
+		Collisions,
+		Scripting,
+		Destruction,
+		Pacing,		// time the frame pacer waited
+		Total,		// whole main loop iteration
+		Count
+	};
+
+	struct PhaseStats
+	{
+		Time min = 0, avg = 0, p99 = 0, max = 0;	// ns
+		unsigned frames = 0;
+	};
+
+	// Per-phase timings of the last HISTORY main loop iterations, in ns.
+	// The game thread is the only writer; each frame is published into a ring
+	// slot guarded by a sequence counter, so stats may be read from any thread
+	// without locks (a slot caught mid-write is just skipped).
+	class FrameProfiler final
+	{
+	public:
+		static constexpr size_t HISTORY = 128;
+		static constexpr size_t PHASES = size_t(FramePhase::Count);
+
+		void SetEnabled(bool v);
+		bool IsEnabled(void) const { return m_Enabled; }
+
+		void SetOverlayVisible(bool v);
+		void ToggleOverlay(void);
+		bool IsOverlayVisible(void) const;
+
+		// Game thread only: phases add up within a frame (several fixed steps
+		// per iteration), EndFrame closes the frame and publishes it
+		void Add(FramePhase phase, Time ns) { m_Current[size_t(phase)] += ns; }
+		void EndFrame(void);
+
+		PhaseStats GetStats(FramePhase phase) const;
+		uint64_t GetFrameCount(void) const;
+
+		static const char* GetPhaseName(FramePhase phase);
+
+	private:
+		struct Slot
+		{
+			std::atomic<uint32_t> seq{ 0 };		// odd while being written
+			std::array<std::atomic<Time>, PHASES> ns{};
+		};
+
+		bool m_Enabled = true;
+		std::atomic<bool> m_OverlayVisible{ false };
+
+		std::array<Time, PHASES> m_Current{};	// frame being measured
+		Time m_FrameStart = 0;
+
+		std::array<Slot, HISTORY> m_Ring;
+		std::atomic<uint64_t> m_Written{ 0 };
+	};
+}
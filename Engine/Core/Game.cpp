@@ -1,4 +1,6 @@
 #include "Core/Game.h"
+#include "Core/SystemClock.h"
+#include "Utils/Assert.h"
 
 namespace core 
 {
@@ -49,42 +51,42 @@ namespace core
 
 	void Game::Render(void)
 	{
-		Invoke(m_Render);
+		Invoke(FramePhase::Render, m_Render);
 	}
 
 	void Game::ProgressAnimations(void)
 	{
-		Invoke(m_Anim);
+		Invoke(FramePhase::Animations, m_Anim);
 	}
 
 	void Game::Input(void)
 	{
-		Invoke(m_Input);
+		Invoke(FramePhase::Input, m_Input);
 	}
 
 	void Game::AI(void)
 	{
-		Invoke(m_Ai);
+		Invoke(FramePhase::AI, m_Ai);
 	}
 
 	void Game::Physics(void)
 	{
-		Invoke(m_Physics);
+		Invoke(FramePhase::Physics, m_Physics);
 	}
 
 	void Game::CollisionChecking(void)
 	{
-		Invoke(m_Collisions);
+		Invoke(FramePhase::Collisions, m_Collisions);
 	}
 
 	void Game::CommitDestruction(void)
 	{
-		Invoke(m_Destruct);
+		Invoke(FramePhase::Destruction, m_Destruct);
 	}
 
 	void Game::UserScripting(void)
 	{
-		Invoke(m_User);
+		Invoke(FramePhase::Scripting, m_User);
 	}
 
 	bool Game::IsFinished(void)
@@ -124,6 +126,40 @@ namespace core
 		return m_PauseTime;
 	}
 
+	void Game::SetFixedStep(unsigned hz, unsigned maxSteps)
+	{
+		ASSERT(!hz || maxSteps, "FAILED. A fixed step needs at least one step per iteration");
+		m_StepUs = hz ? 1000000 / hz : 0;
+		m_MaxSteps = maxSteps;
+		m_Accumulator = 0;
+		m_LastUs = 0;
+	}
+
+	bool Game::HasFixedStep(void) const
+	{
+		return m_StepUs != 0;
+	}
+
+	float Game::GetInterpolationAlpha(void) const
+	{
+		return m_StepUs ? float(m_Accumulator) / float(m_StepUs) : 0.0f;
+	}
+
+	FramePacer& Game::GetFramePacer(void)
+	{
+		return m_Pacer;
+	}
+
+	FrameProfiler& Game::GetProfiler(void)
+	{
+		return m_Profiler;
+	}
+
+	const FrameProfiler& Game::GetProfiler(void) const
+	{
+		return m_Profiler;
+	}
+
 	void Game::MainLoop(void)
 	{
 		while (!IsFinished())
@@ -132,21 +168,105 @@ namespace core
 
 	void Game::MainLoopIteration(void)
 	{
-		Render();
-		Input();
-		if (!IsPaused())
+		if (m_StepUs)
+			FixedStepIteration();
+		else
+		{
+			Render();
+			Input();
+			if (!IsPaused())
+				Step();
+		}
+
+		if (m_Profiler.IsEnabled())
+		{
+			Time start = SystemClock::Get().nano_secs();
+			m_Pacer.Pace();
+			m_Profiler.Add(FramePhase::Pacing, SystemClock::Get().nano_secs() - start);
+			m_Profiler.EndFrame();
+		}
+		else
+			m_Pacer.Pace();
+	}
+
+	void Game::Step(void)
+	{
+		ProgressAnimations();
+		AI();
+		Physics();
+		CollisionChecking();
+		UserScripting();
+		CommitDestruction();
+	}
+
+	void Game::FixedStepIteration(void)
+	{
+		auto& clock = SystemClock::Get();
+		Time now = clock.micro_secs();
+
+		if (IsPaused())
+		{
+			// Menus stay responsive; the simulation resyncs on resume
+			Input();
+			Render();
+			m_LastUs = 0;
+			return;
+		}
+
+		if (!m_LastUs)
+		{
+			m_LastUs = now;
+			m_SimUs = now;
+			m_Accumulator = m_StepUs;	// one step right away
+		}
+		else
 		{
-			ProgressAnimations();
-			AI();
-			Physics();
-			CollisionChecking();
-			UserScripting();
-			CommitDestruction();
+			m_Accumulator += now - m_LastUs;
+			m_LastUs = now;
 		}
+
+		unsigned steps = 0;
+		while (m_Accumulator >= m_StepUs && steps < m_MaxSteps)
+		{
+			m_Accumulator -= m_StepUs;
+			m_SimUs += m_StepUs;
+			clock.SetCurrTime(m_SimUs / 1000);
+			++steps;
+
+			Input();
+			if (IsPaused() || IsFinished())
+			{
+				m_Accumulator = 0;
+				break;
+			}
+			Step();
+		}
+
+		// Too far behind to catch up: let the lost time go rather than spiral
+		if (m_Accumulator >= m_StepUs)
+			m_Accumulator %= m_StepUs;
+
+		Render();
 	}
 
 	void Game::Invoke(const Action& f)
 	{
 		if (f) f();
 	}
+
+	void Game::Invoke(FramePhase phase, const Action& f)
+	{
+		if (!f)
+			return;
+		if (!m_Profiler.IsEnabled())
+		{
+			f();
+			return;
+		}
+
+		auto& clock = SystemClock::Get();
+		Time start = clock.nano_secs();
+		f();
+		m_Profiler.Add(phase, clock.nano_secs() - start);
+	}
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Utils/Common.h"
+#include "Core/FramePacer.h"
+#include "Core/FrameProfiler.h"
 
 #include <functional>
 
@@ -40,6 +42,24 @@ namespace core
 		bool	  IsPaused(void) const;
 		TimeStamp GetPauseTime(void) const;
 
+		// Runs Input through CommitDestruction at a fixed rate: each iteration
+		// takes as many whole steps as real time has accumulated (at most
+		// maxSteps, dropping the rest after a long stall) and then renders once.
+		// SystemClock's current time advances by exactly one step per step.
+		// hz = 0 goes back to one update per rendered frame.
+		void SetFixedStep(unsigned hz, unsigned maxSteps = 5);
+		bool HasFixedStep(void) const;
+		// Fraction of a step accumulated past the last simulated state, for
+		// the render loop to interpolate with
+		float GetInterpolationAlpha(void) const;
+
+		// Paces every main loop iteration once a target rate is set on it
+		FramePacer& GetFramePacer(void);
+
+		// Times every phase of the main loop (enabled by default)
+		FrameProfiler&		 GetProfiler(void);
+		const FrameProfiler& GetProfiler(void) const;
+
 		void MainLoop(void);
 		void MainLoopIteration(void);
 
@@ -49,13 +69,25 @@ namespace core
 
 	private:
 		inline void Invoke(const Action& f);
+		inline void Invoke(FramePhase phase, const Action& f);
+		void Step(void);
+		void FixedStepIteration(void);
 
 	private:
 		Action m_Render, m_Anim, m_Input, m_Ai, m_Physics, m_Collisions, m_User, m_Destruct; 
 		Pred m_Done;
 
+		FramePacer m_Pacer;
+		FrameProfiler m_Profiler;
+
 		Action m_PauseResume;
 		bool m_IsPaused = false;
 		TimeStamp m_PauseTime = 0;
+
+		Time	 m_StepUs = 0;			// 0 when not running a fixed step
+		unsigned m_MaxSteps = 0;
+		Time	 m_Accumulator = 0;		// real time not yet simulated, in us
+		Time	 m_LastUs = 0;			// real time of the previous iteration, 0 to resync
+		Time	 m_SimUs = 0;			// simulated time, fed to SystemClock in ms
 	};
 }
\ No newline at end of file
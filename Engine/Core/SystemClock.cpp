@@ -29,6 +29,11 @@ namespace core
 		m_CurrTime = milli_secs();
 	}
 
+	void SystemClock::SetCurrTime(TimeStamp t)
+	{
+		m_CurrTime = t;
+	}
+
 	TimeStamp SystemClock::GetCurrTime() const
 	{
 		return m_CurrTime;
@@ -15,6 +15,7 @@ namespace core
 		Time nano_secs(void) const;
 
 		void	  SetCurrTime();
+		void	  SetCurrTime(TimeStamp t);
 		TimeStamp GetCurrTime() const;
 		void      ClearCurrTime();
 
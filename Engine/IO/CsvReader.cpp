@@ -0,0 +1,116 @@
+#include "IO/CsvReader.h"
+
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+namespace io
+{
+	// Below this many rows per worker the thread start up costs more than it saves
+	static constexpr size_t MIN_ROWS_PER_THREAD = 64;
+
+	static inline const char* SkipBlanks(const char* p, const char* end)
+	{
+		while (p < end && (*p == ' ' || *p == '\t'))
+			++p;
+		return p;
+	}
+
+	static bool ParseRow(std::string_view line, size_t cols, int* values)
+	{
+		const char* p = line.data();
+		const char* end = p + line.size();
+
+		for (size_t col = 0; col < cols; ++col)
+		{
+			if (col)
+			{
+				if (p == end || *p != ',')
+					return false;	// short row
+				++p;
+			}
+
+			p = SkipBlanks(p, end);
+			if (p < end && *p == '+')
+				++p;
+
+			auto [next, ec] = std::from_chars(p, end, values[col]);
+			if (ec != std::errc())
+				return false;
+			p = SkipBlanks(next, end);
+		}
+
+		return true;
+	}
+
+	bool ParseIntCSV(std::string_view text, size_t rows, size_t cols, const CsvRowFunc& onRow, size_t rowAlign)
+	{
+		if (!rows || !cols || !rowAlign)
+			return false;
+
+		// Index the non empty lines first, that pass is a memchr per line and
+		// gives every worker its rows up front
+		std::vector<std::string_view> lines;
+		lines.reserve(rows);
+
+		const char* p = text.data();
+		const char* end = p + text.size();
+		while (p < end && lines.size() < rows)
+		{
+			const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+			if (!eol)
+				eol = end;
+
+			const char* last = eol;
+			if (last > p && last[-1] == '\r')
+				--last;
+			if (last > p)
+				lines.emplace_back(p, last - p);
+
+			p = eol + 1;
+		}
+
+		if (lines.size() != rows)
+			return false;	// row count mismatch
+
+		std::atomic<bool> ok{ true };
+		auto parseRange = [&](size_t first, size_t last)
+		{
+			std::vector<int> values(cols);
+			for (size_t row = first; row < last && ok.load(std::memory_order_relaxed); ++row)
+			{
+				if (!ParseRow(lines[row], cols, values.data()))
+				{
+					ok.store(false, std::memory_order_relaxed);
+					return;
+				}
+				onRow(row, values.data());
+			}
+		};
+
+		size_t workers = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+		workers = std::clamp<size_t>(rows / MIN_ROWS_PER_THREAD, 1, workers);
+
+		// The calling thread takes the first range itself
+		std::vector<std::thread> threads;
+		threads.reserve(workers - 1);
+		size_t perWorker = (rows + workers - 1) / workers;
+		perWorker = (perWorker + rowAlign - 1) / rowAlign * rowAlign;
+		for (size_t w = 1; w < workers; ++w)
+		{
+			size_t first = w * perWorker;
+			if (first >= rows)
+				break;
+			threads.emplace_back(parseRange, first, std::min(first + perWorker, rows));
+		}
+		parseRange(0, std::min(perWorker, rows));
+
+		for (auto& t : threads)
+			t.join();
+
+		return ok.load();
+	}
+}
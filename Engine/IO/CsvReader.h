@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string_view>
+#include <functional>
+#include <cstddef>
+
+namespace io
+{
+	// Called once per row with its first cols values. Rows are handed out to
+	// worker threads in contiguous ranges, so the callback may only write to
+	// storage owned by that row.
+	using CsvRowFunc = std::function<void(size_t row, const int* values)>;
+
+	// Parses rows x cols integers without allocating per cell. Empty lines are
+	// skipped, lines after the last row and values after the last column are
+	// ignored. Fails on a short file, a short row or a malformed value.
+	// Worker ranges start at multiples of rowAlign, so every band of rowAlign
+	// rows is parsed whole, in order and on a single thread.
+	bool ParseIntCSV(std::string_view text, size_t rows, size_t cols, const CsvRowFunc& onRow, size_t rowAlign = 1);
+}
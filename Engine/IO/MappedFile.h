@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Utils/Common.h"
+
+#include <string>
+#include <cstddef>
+
+namespace io
+{
+	// Read only view of a whole file mapped into memory. The view stays valid
+	// until Close (or destruction), the file can not be rewritten meanwhile.
+	class MappedFile final
+	{
+	public:
+		bool		Open(const std::string& path);
+		void		Close(void);
+
+		bool		IsOpen(void) const { return m_Data != nullptr; }
+		const byte* Data(void) const { return m_Data; }
+		size_t		Size(void) const { return m_Size; }
+
+		MappedFile(void) = default;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile() { Close(); }
+
+	private:
+		const byte* m_Data = nullptr;
+		size_t		m_Size = 0;
+#if defined(_WIN32)
+		void*		m_File = nullptr;
+		void*		m_Mapping = nullptr;
+#else
+		int			m_Fd = -1;
+#endif
+	};
+}
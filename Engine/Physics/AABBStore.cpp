@@ -0,0 +1,95 @@
+#include "Physics/AABBStore.h"
+#include "Utils/Assert.h"
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+	#define AABB_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define AABB_SSE2 1
+#endif
+
+namespace physics
+{
+	void AABBStore::Clear(void)
+	{
+		m_X1.clear();
+		m_Y1.clear();
+		m_X2.clear();
+		m_Y2.clear();
+	}
+
+	Index AABBStore::Push(unsigned x1, unsigned y1, unsigned x2, unsigned y2)
+	{
+		m_X1.push_back((int32_t)(x1 ^ BIAS));
+		m_Y1.push_back((int32_t)(y1 ^ BIAS));
+		m_X2.push_back((int32_t)(x2 ^ BIAS));
+		m_Y2.push_back((int32_t)(y2 ^ BIAS));
+		return Size() - 1;
+	}
+
+	bool AABBStore::Overlaps(Index a, Index b) const
+	{
+		// Non short-circuit on purpose, no branches in the batch tail
+		return !((m_X2[a] < m_X1[b]) | (m_X2[b] < m_X1[a]) |
+			(m_Y2[a] < m_Y1[b]) | (m_Y2[b] < m_Y1[a]));
+	}
+
+	uint32_t AABBStore::OverlapMask(Index a, Index first, Index count) const
+	{
+		ASSERT(count <= BATCH && first + count <= Size(), "FAILED. Box batch is out of range!");
+
+		const int32_t* x1 = m_X1.data() + first;
+		const int32_t* y1 = m_Y1.data() + first;
+		const int32_t* x2 = m_X2.data() + first;
+		const int32_t* y2 = m_Y2.data() + first;
+
+		uint32_t mask = 0;
+		Index i = 0;
+
+#if defined(AABB_AVX2)
+		const __m256i ax1 = _mm256_set1_epi32(m_X1[a]), ay1 = _mm256_set1_epi32(m_Y1[a]);
+		const __m256i ax2 = _mm256_set1_epi32(m_X2[a]), ay2 = _mm256_set1_epi32(m_Y2[a]);
+
+		for (; i + 8 <= count; i += 8)
+		{
+			// Separated on any axis, one compare per side
+			__m256i sep = _mm256_or_si256(
+				_mm256_or_si256(
+					_mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(x1 + i)), ax2),
+					_mm256_cmpgt_epi32(ax1, _mm256_loadu_si256((const __m256i*)(x2 + i)))
+				),
+				_mm256_or_si256(
+					_mm256_cmpgt_epi32(_mm256_loadu_si256((const __m256i*)(y1 + i)), ay2),
+					_mm256_cmpgt_epi32(ay1, _mm256_loadu_si256((const __m256i*)(y2 + i)))
+				)
+			);
+			mask |= (~(uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(sep)) & 0xFFu) << i;
+		}
+#elif defined(AABB_SSE2)
+		const __m128i ax1 = _mm_set1_epi32(m_X1[a]), ay1 = _mm_set1_epi32(m_Y1[a]);
+		const __m128i ax2 = _mm_set1_epi32(m_X2[a]), ay2 = _mm_set1_epi32(m_Y2[a]);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			// Separated on any axis, one compare per side
+			__m128i sep = _mm_or_si128(
+				_mm_or_si128(
+					_mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)(x1 + i)), ax2),
+					_mm_cmpgt_epi32(ax1, _mm_loadu_si128((const __m128i*)(x2 + i)))
+				),
+				_mm_or_si128(
+					_mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)(y1 + i)), ay2),
+					_mm_cmpgt_epi32(ay1, _mm_loadu_si128((const __m128i*)(y2 + i)))
+				)
+			);
+			mask |= (~(uint32_t)_mm_movemask_ps(_mm_castsi128_ps(sep)) & 0xFu) << i;
+		}
+#endif
+
+		for (; i < count; ++i)
+			mask |= (uint32_t)Overlaps(a, first + i) << i;
+
+		return mask;
+	}
+}
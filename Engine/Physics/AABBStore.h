@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Utils/Common.h"
+
+#include <bit>
+#include <vector>
+#include <algorithm>
+
+namespace physics
+{
+	// Axis aligned boxes kept as four parallel coordinate arrays so one box can
+	// be tested against a whole run of others with SIMD compares (AVX2 or SSE2
+	// when the build enables them, scalar otherwise). Bounds are inclusive and
+	// stored sign-flipped, so unsigned order survives signed vector compares.
+	class AABBStore final
+	{
+	public:
+		static constexpr Index BATCH = 16;	// boxes per OverlapMask call
+
+		void	Clear(void);
+		Index	Push(unsigned x1, unsigned y1, unsigned x2, unsigned y2);
+		Index	Size(void) const { return (Index)m_X1.size(); }
+
+		unsigned X1(Index i) const { return (unsigned)m_X1[i] ^ BIAS; }
+		unsigned Y1(Index i) const { return (unsigned)m_Y1[i] ^ BIAS; }
+		unsigned X2(Index i) const { return (unsigned)m_X2[i] ^ BIAS; }
+		unsigned Y2(Index i) const { return (unsigned)m_Y2[i] ^ BIAS; }
+
+		bool	 Overlaps(Index a, Index b) const;
+
+		// Bit i is set when box first + i overlaps box a, count <= BATCH
+		uint32_t OverlapMask(Index a, Index first, Index count) const;
+
+		// Calls f(i) for every box i in [first, last) overlapping box a
+		template <typename F>
+		void ForEachOverlap(Index a, Index first, Index last, F&& f) const
+		{
+			for (Index base = first; base < last; base += BATCH)
+			{
+				uint32_t mask = OverlapMask(a, base, std::min<Index>(BATCH, last - base));
+				while (mask)
+				{
+					f(base + (Index)std::countr_zero(mask));
+					mask &= mask - 1;
+				}
+			}
+		}
+
+	private:
+		static constexpr uint32_t BIAS = 0x80000000u;
+
+		std::vector<int32_t> m_X1, m_Y1, m_X2, m_Y2;
+	};
+}
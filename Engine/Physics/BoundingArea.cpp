@@ -41,6 +41,14 @@ namespace physics
 		return area.Intersects(*this);
 	}
 
+	void BoundingBox::GetBounds(unsigned* _x1, unsigned* _y1, unsigned* _x2, unsigned* _y2) const
+	{
+		*_x1 = x1;
+		*_y1 = y1;
+		*_x2 = x2;
+		*_y2 = y2;
+	}
+
 	BoundingArea* BoundingBox::Clone() const
 	{
 		return new BoundingBox(*this);
@@ -102,6 +110,14 @@ namespace physics
 			(t2 >= 0.0f && t2 <= 1.0f);
 	}
 
+	void BoundingCircle::GetBounds(unsigned* x1, unsigned* y1, unsigned* x2, unsigned* y2) const
+	{
+		*x1 = x > r ? x - r : 0;
+		*y1 = y > r ? y - r : 0;
+		*x2 = x + r;
+		*y2 = y + r;
+	}
+
 	BoundingCircle* BoundingCircle::Clone() const
 	{
 		return new BoundingCircle(*this);
@@ -18,6 +18,9 @@ namespace physics
 		virtual bool In(unsigned x, unsigned y) const = 0;
 		virtual bool Intersects(const BoundingArea& area) const = 0;
 
+		// Inclusive axis aligned bounds, used by the collision broadphase
+		virtual void GetBounds(unsigned* x1, unsigned* y1, unsigned* x2, unsigned* y2) const = 0;
+
 		virtual BoundingArea* Clone(void) const = 0;
 
 		virtual ~BoundingArea() {}
@@ -32,6 +35,8 @@ namespace physics
 		virtual bool In(unsigned x, unsigned y) const override;
 		virtual bool Intersects(const BoundingArea& area) const override;
 
+		virtual void GetBounds(unsigned* x1, unsigned* y1, unsigned* x2, unsigned* y2) const override;
+
 		virtual BoundingArea* Clone(void) const override;
 
 		BoundingBox(unsigned _x1, unsigned _y1, unsigned _x2, unsigned _y2);
@@ -51,6 +56,8 @@ namespace physics
 		virtual bool In(unsigned x, unsigned y) const override;
 		virtual bool Intersects(const BoundingArea& area) const override;
 
+		virtual void GetBounds(unsigned* x1, unsigned* y1, unsigned* x2, unsigned* y2) const override;
+
 		virtual BoundingCircle* Clone(void) const override;
 
 		BoundingCircle(unsigned _x, unsigned _y, unsigned _r);
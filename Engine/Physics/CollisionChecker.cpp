@@ -8,43 +8,206 @@ namespace physics
 {
 	CollisionChecker CollisionChecker::s_Checker;
 
-	void CollisionChecker::Register(Sprite* s1, Sprite* s2, const Action& f)
+	void CollisionChecker::Add(Sprite* s)
 	{
-		ASSERT(!In(s1, s2), "FAILED, sprites have already been registered for collision!");
-		m_Entries.push_back(std::make_tuple(s1, s2, f));
+		ASSERT(s, "FAILED. Sprite was nullptr!");
+		ASSERT(!In(s), "FAILED, sprite has already been added for collision!");
+		ASSERT(s->GetBoundingArea(), "FAILED. Sprite does not have a bounding area!");
+
+		s->m_CollisionSlot = (int)m_Sprites.size();
+		m_Sprites.push_back(s);
+		m_IsBox.push_back(dynamic_cast<const BoundingBox*>(s->GetBoundingArea()) != nullptr);
+	}
+
+	void CollisionChecker::Remove(Sprite* s) 
+	{
+		ASSERT(In(s), "FAILED, sprite was not added for collision!");
+		ASSERT(!m_Checking, "FAILED, sprites can not be removed from a collision handler!");
+
+		// Swap with the last one, slots of the others stay put
+		Index slot = (Index)s->m_CollisionSlot;
+		m_Sprites[slot] = m_Sprites.back();
+		m_Sprites[slot]->m_CollisionSlot = (int)slot;
+		m_Sprites.pop_back();
+		m_IsBox[slot] = m_IsBox.back();
+		m_IsBox.pop_back();
+
+		s->m_CollisionSlot = -1;
 	}
 
-	void CollisionChecker::Cancel(Sprite* s1, Sprite* s2) 
+	bool CollisionChecker::In(const Sprite* s) const
 	{
-		m_Entries.erase(Find(s1, s2));
+		return s->m_CollisionSlot >= 0 &&
+			s->m_CollisionSlot < (int)m_Sprites.size() &&
+			m_Sprites[s->m_CollisionSlot] == s;
+	}
+
+	void CollisionChecker::SetHandler(CollisionLayer l1, CollisionLayer l2, const Action& f)
+	{
+		ASSERT(l1 < MAX_COLLISION_LAYERS && l2 < MAX_COLLISION_LAYERS, "FAILED. Collision layer is out of range!");
+		ASSERT(!m_Handlers[l1][l2].action, "FAILED, layers already have a collision handler!");
+
+		m_Handlers[l1][l2] = { f, m_TotalHandlers, false };
+		if (l1 != l2)
+			m_Handlers[l2][l1] = { f, m_TotalHandlers, true };
+		++m_TotalHandlers;
+	}
+
+	void CollisionChecker::ClearHandlers(void)
+	{
+		for (auto& row : m_Handlers)
+			for (auto& handler : row)
+				handler = Handler();
+		m_TotalHandlers = 0;
 	}
 
 	void CollisionChecker::Check(void) const
 	{
-		for (auto& e : m_Entries)
-			if (std::get<0>(e)->CollisionCheck(std::get<1>(e)))
-				std::get<2>(e)(std::get<0>(e), std::get<1>(e));
+		GatherCandidates();
+
+		m_Checking = true;
+		for (auto& c : m_Candidates)
+		{
+			Sprite* s1 = m_Sprites[c.slot1];
+			Sprite* s2 = m_Sprites[c.slot2];
+			if (c.handler->swapped)
+				std::swap(s1, s2);
+
+			if (Intersects(c.slot1, c.slot2))
+				c.handler->action(s1, s2);
+		}
+		m_Checking = false;
 	}
 
-	auto CollisionChecker::Get(void) -> CollisionChecker&
+	auto CollisionChecker::FindHandler(const Sprite* s1, const Sprite* s2) const -> const Handler*
 	{
-		return s_Checker;
+		// Both sides have to accept the other's layer
+		if (!(s1->m_CollisionMask & LayerBit(s2->m_CollisionLayer)) ||
+			!(s2->m_CollisionMask & LayerBit(s1->m_CollisionLayer)))
+			return nullptr;
+
+		auto& handler = m_Handlers[s1->m_CollisionLayer][s2->m_CollisionLayer];
+		return handler.action ? &handler : nullptr;
 	}
 
-	auto CollisionChecker::Find(Sprite* s1, Sprite* s2) -> std::list<Entry>::iterator
+	bool CollisionChecker::Intersects(Index slot1, Index slot2) const
 	{
-		return std::find_if(
-			m_Entries.begin(),
-			m_Entries.end(),
-			[s1, s2](const Entry& e) {
-				return std::get<0>(e) == s1 && std::get<1>(e) == s2 ||
-					std::get<0>(e) == s2 && std::get<1>(e) == s1;
-			});
+		// Circles take the virtual slow path
+		if (!m_IsBox[slot1] || !m_IsBox[slot2])
+			return m_Sprites[slot1]->CollisionCheck(m_Sprites[slot2]);
+
+		// Boxes are re-read here, an earlier handler may have moved them
+		auto* a = static_cast<const BoundingBox*>(m_Sprites[slot1]->GetBoundingArea());
+		auto* b = static_cast<const BoundingBox*>(m_Sprites[slot2]->GetBoundingArea());
+		return !((a->x2 < b->x1) | (a->x1 > b->x2) | (a->y2 < b->y1) | (a->y1 > b->y2));
 	}
 
-	bool CollisionChecker::In(Sprite* s1, Sprite* s2)
+	void CollisionChecker::AddCandidate(Index id1, Index id2) const
 	{
-		return Find(s1, s2) != m_Entries.end();
+		Index slot1 = m_BoxSlots[id1], slot2 = m_BoxSlots[id2];
+		if (auto* handler = FindHandler(m_Sprites[slot1], m_Sprites[slot2]))
+			m_Candidates.push_back({ handler, slot1, slot2 });
 	}
-}
 
+	static inline uint64_t CellKey(uint64_t cx, uint64_t cy)
+	{
+		return (cy << 32) | cx;
+	}
+
+	void CollisionChecker::GatherCandidates(void) const
+	{
+		m_Candidates.clear();
+		m_Boxes.Clear();
+		m_BoxSlots.clear();
+		m_Oversized.clear();
+		m_CellEntries.clear();
+
+		// One box per sprite that can hit anything, binned into the cells it covers
+		for (Index slot = 0; slot < (Index)m_Sprites.size(); ++slot)
+		{
+			auto* s = m_Sprites[slot];
+			if (!s->m_CollisionMask)
+				continue;
+
+			unsigned x1, y1, x2, y2;
+			s->GetBoundingArea()->GetBounds(&x1, &y1, &x2, &y2);
+
+			Index id = m_Boxes.Push(x1, y1, x2, y2);
+			m_BoxSlots.push_back(slot);
+
+			// Boxes that went through negative coordinates wrap around, those are
+			// tested against everything like before
+			if (x1 > x2 || y1 > y2 ||
+				((x2 >> CELL_SHIFT) - (x1 >> CELL_SHIFT)) >= MAX_CELL_SPAN ||
+				((y2 >> CELL_SHIFT) - (y1 >> CELL_SHIFT)) >= MAX_CELL_SPAN)
+			{
+				m_Oversized.push_back(id);
+				continue;
+			}
+
+			for (uint64_t cy = y1 >> CELL_SHIFT; cy <= (y2 >> CELL_SHIFT); ++cy)
+				for (uint64_t cx = x1 >> CELL_SHIFT; cx <= (x2 >> CELL_SHIFT); ++cx)
+					m_CellEntries.push_back({ CellKey(cx, cy), id });
+		}
+
+		// Sort so every cell becomes a contiguous run of box copies
+		std::sort(
+			m_CellEntries.begin(),
+			m_CellEntries.end(),
+			[](const CellEntry& a, const CellEntry& b) { return a.key < b.key || (a.key == b.key && a.id < b.id); }
+		);
+
+		m_CellBoxes.Clear();
+		for (auto& e : m_CellEntries)
+			m_CellBoxes.Push(m_Boxes.X1(e.id), m_Boxes.Y1(e.id), m_Boxes.X2(e.id), m_Boxes.Y2(e.id));
+
+		for (Index begin = 0, end = 0; begin < (Index)m_CellEntries.size(); begin = end)
+		{
+			uint64_t key = m_CellEntries[begin].key;
+			for (end = begin + 1; end < (Index)m_CellEntries.size() && m_CellEntries[end].key == key; ++end)
+				;
+
+			for (Index i = begin; i + 1 < end; ++i)
+				m_CellBoxes.ForEachOverlap(i, i + 1, end,
+					[this, i, key](Index j)
+					{
+						// Overlapping boxes share several cells, only the one holding
+						// the top left corner of the overlap reports the pair
+						uint64_t ownerX = std::max(m_CellBoxes.X1(i), m_CellBoxes.X1(j)) >> CELL_SHIFT;
+						uint64_t ownerY = std::max(m_CellBoxes.Y1(i), m_CellBoxes.Y1(j)) >> CELL_SHIFT;
+						if (CellKey(ownerX, ownerY) == key)
+							AddCandidate(m_CellEntries[i].id, m_CellEntries[j].id);
+					});
+		}
+
+		for (Index n = 0; n < (Index)m_Oversized.size(); ++n)
+		{
+			Index id = m_Oversized[n];
+			m_Boxes.ForEachOverlap(id, 0, m_Boxes.Size(),
+				[this, id, n](Index other)
+				{
+					// Pairs of two oversized boxes are visited from the first one only
+					if (other == id)
+						return;
+					auto i = std::find(m_Oversized.begin(), m_Oversized.begin() + n, other);
+					if (i == m_Oversized.begin() + n)
+						AddCandidate(id, other);
+				});
+		}
+
+		// Deterministic order, independent of the hash layout
+		std::sort(
+			m_Candidates.begin(),
+			m_Candidates.end(),
+			[](const Candidate& a, const Candidate& b) {
+				return std::make_tuple(a.handler->order, std::min(a.slot1, a.slot2), std::max(a.slot1, a.slot2)) <
+					std::make_tuple(b.handler->order, std::min(b.slot1, b.slot2), std::max(b.slot1, b.slot2));
+			}
+		);
+	}
+
+	auto CollisionChecker::Get(void) -> CollisionChecker&
+	{
+		return s_Checker;
+	}
+}
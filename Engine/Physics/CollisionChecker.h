@@ -1,26 +1,41 @@
 #pragma once
 
 #include "Scene/Sprite.h"
+#include "Physics/CollisionLayer.h"
+#include "Physics/AABBStore.h"
 
 #include <tuple>
-#include <list>
+#include <vector>
 #include <functional>
+#include <unordered_map>
 
 namespace physics
 {
 	using namespace scene;
 
+	// Sprites are added once and collide by layer (see Physics/CollisionLayer.h),
+	// a single handler serves every pair of sprites on two layers. Candidate
+	// pairs come from a uniform grid spatial hash over the sprite bounds, so
+	// the narrowphase cost follows local density instead of the sprite count.
+	// Bounds are tested in batches out of an AABBStore, box against box pairs
+	// never go through the virtual BoundingArea::Intersects.
 	class CollisionChecker final
 	{
 	public:
+		// Called with s1 on the first and s2 on the second layer of SetHandler
 		using Action = std::function<void(Sprite* s1, Sprite* s2)>;
 
-	protected:
-		using Entry = std::tuple<Sprite*, Sprite*, Action>;
+		static constexpr unsigned CELL_SHIFT = 7;		// 128x128 pixel hash cells
+		static constexpr unsigned MAX_CELL_SPAN = 16;	// larger bounds skip the hash
 
 	public:
-		void Register(Sprite* s1, Sprite* s2, const Action& f);
-		void Cancel(Sprite* s1, Sprite* s2);
+		void Add(Sprite* s);
+		void Remove(Sprite* s);
+		bool In(const Sprite* s) const;
+
+		void SetHandler(CollisionLayer l1, CollisionLayer l2, const Action& f);
+		void ClearHandlers(void);
+
 		void Check(void) const;
 
 		static auto Get(void) -> CollisionChecker&;
@@ -30,12 +45,46 @@ namespace physics
 		CollisionChecker(CollisionChecker&&) = delete;
 
 	protected:
-		auto Find(Sprite* s1, Sprite* s2) -> std::list<Entry>::iterator;
-		bool In(Sprite* s1, Sprite* s2);
+		struct Handler
+		{
+			Action	 action;
+			unsigned order = 0;		// hits are reported in handler registration order
+			bool	 swapped = false;	// registered as (l2, l1)
+		};
+
+		// Sprite slot and hash cell of one box copy in the cell ordered store
+		struct CellEntry
+		{
+			uint64_t key;
+			Index	 id;	// in m_Boxes
+		};
+
+		struct Candidate
+		{
+			const Handler* handler;
+			Index slot1, slot2;
+		};
+
+		auto FindHandler(const Sprite* s1, const Sprite* s2) const -> const Handler*;
+		void AddCandidate(Index id1, Index id2) const;
+		void GatherCandidates(void) const;
+		bool Intersects(Index slot1, Index slot2) const;
 
 	protected:
 		static CollisionChecker s_Checker;
 
-		std::list<Entry> m_Entries;
+		std::vector<Sprite*> m_Sprites;		// Sprite::m_CollisionSlot indexes this
+		std::vector<byte> m_IsBox;			// per slot, BoundingBox areas skip the virtual narrowphase
+		Handler m_Handlers[MAX_COLLISION_LAYERS][MAX_COLLISION_LAYERS];
+		unsigned m_TotalHandlers = 0;
+		mutable bool m_Checking = false;	// handlers may add sprites but not remove them
+
+		// Broadphase scratch, rebuilt on every Check
+		mutable AABBStore m_Boxes;					// one box per sprite that can hit anything
+		mutable std::vector<Index> m_BoxSlots;		// sprite slot of every box
+		mutable std::vector<Index> m_Oversized;		// boxes tested against all others
+		mutable std::vector<CellEntry> m_CellEntries;
+		mutable AABBStore m_CellBoxes;				// box copies sorted by cell, cells are contiguous runs
+		mutable std::vector<Candidate> m_Candidates;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Utils/Common.h"
+
+namespace physics
+{
+	// A sprite lives on one collision layer and lists the layers it may hit
+	// in its mask. A pair is tested only when each side's mask holds the
+	// other's layer and a handler is registered for the two layers.
+	typedef byte	 CollisionLayer;
+	typedef uint32_t CollisionMask;
+
+	inline constexpr unsigned		MAX_COLLISION_LAYERS = 32;
+	inline constexpr CollisionMask	COLLISION_MASK_NONE = 0;
+	inline constexpr CollisionMask	COLLISION_MASK_ALL = ~0u;
+
+	constexpr CollisionMask LayerBit(CollisionLayer layer)
+	{
+		return CollisionMask(1) << layer;
+	}
+}
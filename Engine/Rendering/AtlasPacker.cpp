@@ -0,0 +1,218 @@
+#include "Rendering/AtlasPacker.h"
+#include "Utils/Assert.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace gfx
+{
+	auto AtlasPacker::Add(Bitmap src, const Rect& from, Index group) -> EntryId
+	{
+		ASSERT(src, "Failed. Bitmap was nullptr!");
+		ASSERT(!m_Built, "Failed. Atlas has already been built!");
+		ASSERT(from.w > 0 && from.h > 0, "Failed. Empty atlas entry!");
+
+		if (m_GroupParent.find(group) == m_GroupParent.end())
+			m_GroupParent[group] = group;
+
+		Key key{ src, from.x, from.y, from.w, from.h };
+		auto i = m_Lookup.find(key);
+		if (i != m_Lookup.end())
+		{
+			// Shared by two groups, both have to live on the same page
+			Index a = FindGroup(m_Entries[i->second].group);
+			Index b = FindGroup(group);
+			if (a != b)
+				m_GroupParent[b] = a;
+			return i->second;
+		}
+
+		Entry e;
+		e.src = src;
+		e.from = from;
+		e.group = group;
+
+		EntryId id = (EntryId)m_Entries.size();
+		m_Entries.push_back(e);
+		m_Lookup[key] = id;
+		return id;
+	}
+
+	Index AtlasPacker::FindGroup(Index group)
+	{
+		Index root = group;
+		while (m_GroupParent[root] != root)
+			root = m_GroupParent[root];
+
+		while (m_GroupParent[group] != root)
+		{
+			Index next = m_GroupParent[group];
+			m_GroupParent[group] = root;
+			group = next;
+		}
+		return root;
+	}
+
+	bool AtlasPacker::Place(Page& page, int size, int w, int h, Point* at) const
+	{
+		// Shelf packing, first shelf that is tall enough and has room left
+		for (auto& shelf : page.shelves)
+			if (h <= shelf.h && shelf.x + w <= size)
+			{
+				*at = { shelf.x, shelf.y };
+				shelf.x += w;
+				return true;
+			}
+
+		if (w > size || page.top + h > size)
+			return false;
+
+		page.shelves.push_back({ page.top, h, w });
+		*at = { 0, page.top };
+		page.top += h;
+		return true;
+	}
+
+	bool AtlasPacker::PackGroup(Page& page, Index pageNo, int size, const std::vector<EntryId>& group, Dim padding)
+	{
+		Page trial = page;
+		for (auto id : group)
+		{
+			auto& e = m_Entries[id];
+			Point at;
+			if (!Place(trial, size, e.from.w + 2 * padding, e.from.h + 2 * padding, &at))
+				return false;
+
+			e.page = pageNo;
+			e.rect = { at.x + padding, at.y + padding, e.from.w, e.from.h };
+		}
+
+		page = trial;
+		return true;
+	}
+
+	void AtlasPacker::Build(Dim maxPageSize, Dim padding)
+	{
+		ASSERT(!m_Built, "Failed. Atlas has already been built!");
+		m_Built = true;
+
+		if (m_Entries.empty())
+			return;
+
+		std::map<Index, std::vector<EntryId>> byGroup;
+		for (EntryId id = 0; id < (EntryId)m_Entries.size(); ++id)
+			byGroup[FindGroup(m_Entries[id].group)].push_back(id);
+
+		// Tallest first packs shelves tighter
+		auto taller = [this](EntryId a, EntryId b) { return m_Entries[a].from.h > m_Entries[b].from.h; };
+
+		std::vector<std::vector<EntryId>> groups;
+		for (auto& g : byGroup)
+		{
+			std::stable_sort(g.second.begin(), g.second.end(), taller);
+			groups.push_back(std::move(g.second));
+		}
+		std::stable_sort(groups.begin(), groups.end(),
+			[taller](const auto& a, const auto& b) { return taller(a.front(), b.front()); });
+
+		std::vector<int> pageSizes;
+
+		// Smallest power-of-two page that holds everything
+		for (int size = 64; size <= (int)maxPageSize && pageSizes.empty(); size *= 2)
+		{
+			Page page;
+			bool fits = true;
+			for (auto& g : groups)
+				if (!(fits = PackGroup(page, 0, size, g, padding)))
+					break;
+			if (fits)
+				pageSizes.push_back(size);
+		}
+
+		// Otherwise spill over several pages of the maximum size
+		if (pageSizes.empty())
+		{
+			std::vector<Page> pages;
+			for (auto& g : groups)
+			{
+				if (pages.empty() || !PackGroup(pages.back(), (Index)pages.size() - 1, maxPageSize, g, padding))
+				{
+					pages.emplace_back();
+					pageSizes.push_back(maxPageSize);
+					bool placed = PackGroup(pages.back(), (Index)pages.size() - 1, maxPageSize, g, padding);
+					ASSERT(placed, "Failed. Atlas group does not fit in a single page!");
+				}
+			}
+		}
+
+		CopyPixels(pageSizes);
+	}
+
+	void AtlasPacker::CopyPixels(const std::vector<int>& pageSizes)
+	{
+		for (auto size : pageSizes)
+		{
+			Bitmap page = BitmapCreate((Dim)size, (Dim)size);
+			BitmapClear(page, MakeColor(0, 0, 0, 0));
+			m_Pages.push_back(page);
+		}
+
+		for (Index pageNo = 0; pageNo < (Index)m_Pages.size(); ++pageNo)
+		{
+			Bitmap page = m_Pages[pageNo];
+			ASSERT(BitmapLock(page), "Failed to lock atlas page!");
+
+			auto dstBase = BitmapGetMemory(page);
+			auto dstPitch = BitmapGetLineOffset(page);
+
+			for (auto& e : m_Entries)
+			{
+				if (e.page != pageNo)
+					continue;
+
+				ASSERT(BitmapLockRect(e.src, e.from), "Failed to lock atlas source!");
+				auto srcBase = BitmapGetMemory(e.src);
+				auto srcPitch = BitmapGetLineOffset(e.src);
+
+				for (int y = 0; y < e.from.h; ++y)
+					memcpy(
+						dstBase + (e.rect.y + y) * dstPitch + e.rect.x * sizeof(Color),
+						srcBase + (e.from.y + y) * srcPitch + e.from.x * sizeof(Color),
+						e.from.w * sizeof(Color)
+					);
+
+				BitmapUnlock(e.src);
+			}
+
+			BitmapUnlock(page);
+		}
+	}
+
+	void AtlasPacker::CleanUp(void)
+	{
+		for (auto page : m_Pages)
+			BitmapDestroy(page);
+		m_Pages.clear();
+		m_Entries.clear();
+		m_Lookup.clear();
+		m_GroupParent.clear();
+		m_Built = false;
+	}
+
+	Bitmap AtlasPacker::GetPage(EntryId id) const
+	{
+		ASSERT(m_Built && id < m_Entries.size(), "Failed. Atlas entry is not available!");
+		return m_Pages[m_Entries[id].page];
+	}
+
+	const Rect& AtlasPacker::GetRect(EntryId id) const
+	{
+		ASSERT(m_Built && id < m_Entries.size(), "Failed. Atlas entry is not available!");
+		return m_Entries[id].rect;
+	}
+
+	Index AtlasPacker::GetTotalPages(void) const
+	{
+		return (Index)m_Pages.size();
+	}
+}
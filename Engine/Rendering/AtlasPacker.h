@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Rendering/Bitmap.h"
+#include "Utils/Common.h"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace gfx
+{
+	// Packs sub-rectangles of source bitmaps into power-of-two atlas pages.
+	// Entries of the same group always end up on the same page, identical
+	// (bitmap, rect) pairs are stored once. Pages are owned by the packer.
+	class AtlasPacker final
+	{
+	public:
+		using EntryId = Index;
+
+		EntryId		Add(Bitmap src, const Rect& from, Index group = 0);
+		void		Build(Dim maxPageSize = 2048, Dim padding = 1);
+		void		CleanUp(void);
+
+		Bitmap		GetPage(EntryId id) const;
+		const Rect& GetRect(EntryId id) const;
+		Index		GetTotalPages(void) const;
+
+		AtlasPacker(void) = default;
+		AtlasPacker(const AtlasPacker&) = delete;
+		AtlasPacker(AtlasPacker&&) = delete;
+		~AtlasPacker() { CleanUp(); }
+
+	private:
+		struct Entry
+		{
+			Bitmap	src = nullptr;
+			Rect	from{};
+			Index	group = 0;
+			Index	page = 0;
+			Rect	rect{};
+		};
+
+		struct Shelf
+		{
+			int y = 0, h = 0, x = 0;
+		};
+
+		struct Page
+		{
+			std::vector<Shelf>	shelves;
+			int					top = 0;
+		};
+
+		using Key = std::tuple<Bitmap, int, int, int, int>;
+
+		Index FindGroup(Index group);
+		bool  Place(Page& page, int size, int w, int h, Point* at) const;
+		bool  PackGroup(Page& page, Index pageNo, int size, const std::vector<EntryId>& group, Dim padding);
+		void  CopyPixels(const std::vector<int>& pageSizes);
+
+	private:
+		std::vector<Entry>		m_Entries;
+		std::map<Key, EntryId>	m_Lookup;
+		std::map<Index, Index>	m_GroupParent;	// groups sharing an entry are merged
+		std::vector<Bitmap>		m_Pages;
+		bool					m_Built = false;
+	};
+}
@@ -1,4 +1,6 @@
 #include "Rendering/Bitmap.h"
+#include "Rendering/BitmapData.h"
+#include "Rendering/BlitQueue.h"
 #include "Utils/Assert.h"
 
 #include <SDL3/SDL.h>
@@ -13,20 +15,62 @@ namespace gfx
 	extern SDL_Renderer*				  g_pRenderer;
 	extern const SDL_PixelFormatDetails*  g_pSuportedPixelFormat;
 	extern Color						  g_ClearColor;
-
-	struct BitmapData
-	{
-		SDL_Surface* surf = nullptr;
-		SDL_Texture* texture = nullptr;
-		int isDirty = 0;
-	};
 }
 
 namespace gfx
 {
 	static inline BitmapData* AllocateBitmapData()
 	{
-		return (BitmapData*)malloc(sizeof(BitmapData));
+		auto data = (BitmapData*)malloc(sizeof(BitmapData));
+		ASSERT(data, "Failed to allocate bitmap data!");
+		*data = BitmapData{};
+		return data;
+	}
+
+	// Pulls the part of the GPU copy that is newer than the surface and lies
+	// inside area back into the surface
+	static void SyncSurface(BitmapData* bmpData, const SDL_Rect& area)
+	{
+		if (!bmpData->isDirty)
+			return;
+
+		SDL_Rect stale;
+		if (SDL_GetRectIntersection(&bmpData->dirtyRect, &area, &stale))
+		{
+			BindRenderTarget(bmpData->texture);
+
+			SDL_Surface* read = SDL_RenderReadPixels(g_pRenderer, &stale);
+			ASSERT(read, "FAILED to read texture from gpu and update the gpu surface!");
+
+			if (read->format != g_pSuportedPixelFormat->format)
+			{
+				auto converted = SDL_ConvertSurface(read, g_pSuportedPixelFormat->format);
+				ASSERT(converted, "FAILED to convert to supported pixel formal!");
+				SDL_DestroySurface(read);
+				read = converted;
+			}
+
+			auto bmpSurf = bmpData->surf;
+			const int bpp = g_pSuportedPixelFormat->bytes_per_pixel;
+			const int rowBytes = stale.w * bpp;
+
+			auto dst = (uint8_t*)bmpSurf->pixels + stale.y * bmpSurf->pitch + stale.x * bpp;
+			auto src = (const uint8_t*)read->pixels;
+			for (int y = 0; y < stale.h; ++y)
+			{
+				memcpy(dst, src, rowBytes);
+				dst += bmpSurf->pitch;
+				src += read->pitch;
+			}
+
+			SDL_DestroySurface(read);
+		}
+
+		// Stays dirty if part of the stale area was left out
+		SDL_Rect merged;
+		SDL_GetRectUnion(&bmpData->dirtyRect, &area, &merged);
+		if (SDL_RectsEqual(&merged, &area))
+			bmpData->isDirty = 0;
 	}
 
 	Bitmap BitmapLoad(const char* path)
@@ -164,6 +208,8 @@ namespace gfx
 	{
 		ASSERT(bmp, "Failed. Bitmap was nullptr!");
 		auto bmpData = (BitmapData*)(bmp);
+		PrepareBitmapRead(bmpData);
+		SyncSurface(bmpData, { 0, 0, bmpData->surf->w, bmpData->surf->h });
 		auto bmpSurf = bmpData->surf;
 
 		auto cpySurf = SDL_ConvertSurface(bmpSurf, bmpSurf->format);
@@ -215,6 +261,11 @@ namespace gfx
 		auto bmpSurf = bmpData->surf;
 		auto bmpTexture = bmpData->texture;
 
+		// Whatever was queued into the bitmap is overwritten anyway
+		DiscardBlits(bmpData);
+		PrepareBitmapWrite(bmpData);
+		bmpData->isDirty = 0;
+
 		ASSERT(SDL_FillSurfaceRect(
 			bmpSurf,
 			nullptr,
@@ -236,7 +287,12 @@ namespace gfx
 		auto bmpSurf = bmpData->surf;
 		auto bmpTexture = bmpData->texture;
 
+		DiscardBlits(bmpData);
+		PrepareBitmapWrite(bmpData);
+		ASSERT(bmpData->sampledCount == 0, "Destroyed bitmap is still referenced by pending blits!");
+
 		SDL_DestroySurface(bmpSurf);
+		ReleaseRenderTarget(bmpTexture);
 		SDL_DestroyTexture(bmpTexture);
 		free(bmp);
 	}
@@ -260,38 +316,27 @@ namespace gfx
 	}
 
 	bool BitmapLock(Bitmap bmp)
+	{
+		ASSERT(bmp, "Failed. Bitmap was nullptr!");
+		return BitmapLockRect(bmp, { 0, 0, (int)BitmapGetWidth(bmp), (int)BitmapGetHeight(bmp) });
+	}
+
+	bool BitmapLockRect(Bitmap bmp, const Rect& rect)
 	{
 		ASSERT(bmp, "Failed. Bitmap was nullptr!");
 		auto bmpData = (BitmapData*)(bmp);
 		auto bmpSurf = bmpData->surf;
-		auto bmpText = bmpData->texture;
-	
-		if (bmpData->isDirty)
-		{
-			ASSERT(SDL_SetRenderTarget(
-				g_pRenderer,
-				bmpText
-			), SDL_GetError());
-		
-			SDL_DestroySurface(bmpData->surf);
-			bmpData->surf = SDL_RenderReadPixels(g_pRenderer, nullptr);
-			ASSERT(bmpData->surf, "FAILED to read texture from gpu and update the gpu surface!");
-
-			if (bmpData->surf->format != g_pSuportedPixelFormat->format)
-			{
-				auto converted = SDL_ConvertSurface(bmpData->surf, g_pSuportedPixelFormat->format);
-				ASSERT(converted, "FAILED to convert to supported pixel formal!");
-				SDL_DestroySurface(bmpData->surf);
-				bmpData->surf = converted;
-			}
 
-			ASSERT(SDL_SetRenderTarget(
-				g_pRenderer,
-				nullptr
-			), SDL_GetError());
+		// The surface is written back on unlock, so both hazards apply
+		PrepareBitmapRead(bmpData);
+		PrepareBitmapWrite(bmpData);
 
-			bmpData->isDirty = 0;
-		}
+		SDL_Rect bounds{ 0, 0, bmpSurf->w, bmpSurf->h };
+		SDL_Rect area{ rect.x, rect.y, rect.w, rect.h };
+		if (!SDL_GetRectIntersection(&area, &bounds, &bmpData->lockRect))
+			bmpData->lockRect = { 0, 0, 0, 0 };
+		else
+			SyncSurface(bmpData, bmpData->lockRect);
 
 		if (SDL_MUSTLOCK(bmpSurf))
 			if (!SDL_LockSurface(bmpSurf))
@@ -300,7 +345,6 @@ namespace gfx
 				return false;
 			}
 
-
 		return true;
 	}
 
@@ -310,15 +354,25 @@ namespace gfx
 		auto bmpData = (BitmapData*)(bmp);
 		auto bmpSurf = bmpData->surf;
 		auto bmpTexture = bmpData->texture;
+		auto& area = bmpData->lockRect;
 
 		SDL_UnlockSurface(bmpSurf);
 
+		if (SDL_RectEmpty(&area))
+			return;
+
+		auto pixels = (uint8_t*)bmpSurf->pixels
+			+ area.y * bmpSurf->pitch
+			+ area.x * g_pSuportedPixelFormat->bytes_per_pixel;
+
 		ASSERT(SDL_UpdateTexture(
 			bmpTexture,
-			nullptr,
-			bmpSurf->pixels,
+			&area,
+			pixels,
 			bmpSurf->pitch
 		), SDL_GetError());
+
+		area = { 0, 0, 0, 0 };
 	}
 
 	PixelMemory BitmapGetMemory(Bitmap bmp)
@@ -370,7 +424,7 @@ namespace gfx
 	{
 		ASSERT(bmp, "Failed. Bitmap was nullptr!");
 
-		if (!BitmapLock(bmp))
+		if (!BitmapLockRect(bmp, { (int)x, (int)y, 1, 1 }))
 			return;
 
 		uint8_t* base = BitmapGetMemory(bmp);
@@ -413,33 +467,14 @@ namespace gfx
 	{
 		ASSERT(src, "Failed. Bitmap was nullptr!");
 		auto srcData = (BitmapData*)(src);
-		auto srcTexture = srcData->texture;
 
 		ASSERT(dest, "Failed. Dest bitmap was nullptr!");
 		auto destData = (BitmapData*)(dest);
-		auto destTexture = destData->texture;
 
 		SDL_FRect srcRect{ (float)from.x, (float)from.y, (float)from.w, (float)from.h };
 		SDL_FRect dstRect{ (float)to.x,   (float)to.y,   (float)from.w, (float)from.h };
 
-		ASSERT(SDL_SetRenderTarget(
-			g_pRenderer,
-			destTexture
-		), SDL_GetError());
-
-		ASSERT(SDL_RenderTexture(
-			g_pRenderer,
-			srcTexture,
-			&srcRect,
-			&dstRect
-		), SDL_GetError());
-
-		ASSERT(SDL_SetRenderTarget(
-			g_pRenderer,
-			nullptr
-		), SDL_GetError());
-
-		destData->isDirty = 1;
+		QueueBlit(srcData, srcRect, destData, dstRect, SDL_FLIP_NONE);
 	}
 
 	void BitmapBlitFlipped(Bitmap src, const Rect& from, Bitmap dest, const Point& to,
@@ -447,11 +482,9 @@ namespace gfx
 	{
 		ASSERT(src, "Failed. Bitmap was nullptr!");
 		auto srcData = (BitmapData*)(src);
-		auto srcTexture = srcData->texture;
 
 		ASSERT(dest, "Failed. Dest bitmap was nullptr!");
 		auto destData = (BitmapData*)(dest);
-		auto destTexture = destData->texture;
 
 		SDL_FRect srcRect{ (float)from.x, (float)from.y, (float)from.w, (float)from.h };
 		SDL_FRect dstRect{ (float)to.x,   (float)to.y,   (float)from.w, (float)from.h };
@@ -460,60 +493,64 @@ namespace gfx
 		if (flipH) flip = (SDL_FlipMode)(flip | SDL_FLIP_HORIZONTAL);
 		if (flipV) flip = (SDL_FlipMode)(flip | SDL_FLIP_VERTICAL);
 
-		ASSERT(SDL_SetRenderTarget(
-			g_pRenderer,
-			destTexture
-		), SDL_GetError());
-
-		ASSERT(SDL_RenderTextureRotated(
-			g_pRenderer,
-			srcTexture,
-			&srcRect,
-			&dstRect,
-			0.0,
-			nullptr,
-			flip
-		), SDL_GetError());
-
-		ASSERT(SDL_SetRenderTarget(
-			g_pRenderer,
-			nullptr
-		), SDL_GetError());
-
-		destData->isDirty = 1;
+		QueueBlit(srcData, srcRect, destData, dstRect, flip);
 	}
 
 	void BitmapBlitScaled(Bitmap src, const Rect& from, Bitmap dest, const Rect& to)
 	{
 		ASSERT(src, "Failed. Bitmap was nullptr!");
 		auto srcData = (BitmapData*)(src);
-		auto srcTexture = srcData->texture;
 
 		ASSERT(dest, "Failed. Dest bitmap was nullptr!");
 		auto destData = (BitmapData*)(dest);
-		auto destTexture = destData->texture;
 
 		SDL_FRect srcRect{ (float)from.x, (float)from.y, (float)from.w, (float)from.h };
 		SDL_FRect dstRect{ (float)to.x,   (float)to.y,   (float)to.w,   (float)to.h };
 
-		ASSERT(SDL_SetRenderTarget(
-			g_pRenderer,
-			destTexture
-		), SDL_GetError());
+		QueueBlit(srcData, srcRect, destData, dstRect, SDL_FLIP_NONE);
+	}
 
-		ASSERT(SDL_RenderTexture(
-			g_pRenderer,
-			srcTexture,
-			&srcRect,
-			&dstRect
-		), SDL_GetError());
+	static inline SDL_FColor ToFColor(Color c, Alpha alpha)
+	{
+		return {
+			(float)((c & GetRedBitMaskRGBA()) >> GetRedShiftRGBA()) / 255.0f,
+			(float)((c & GetGreenBitMaskRGBA()) >> GetGreenShiftRGBA()) / 255.0f,
+			(float)((c & GetBlueBitMaskRGBA()) >> GetBlueShiftRGBA()) / 255.0f,
+			(float)alpha / 255.0f
+		};
+	}
 
-		ASSERT(SDL_SetRenderTarget(
-			g_pRenderer,
-			nullptr
-		), SDL_GetError());
+	void BitmapFillRect(Bitmap bmp, const Rect& rect, Color c)
+	{
+		ASSERT(bmp, "Failed. Bitmap was nullptr!");
+		auto bmpData = (BitmapData*)(bmp);
+
+		if (rect.w <= 0 || rect.h <= 0)
+			return;
+
+		Alpha alpha = (Alpha)((c & GetAlphaBitMaskRGBA()) >> GetAlphaShiftRGBA());
+		SDL_FRect dstRect{ (float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h };
+
+		QueueFill(bmpData, dstRect, ToFColor(c, alpha), SDL_BLENDMODE_NONE);
+	}
 
-		destData->isDirty = 1;
+	void BitmapFillRectBlended(Bitmap bmp, const Rect& rect, Color c, Alpha alpha)
+	{
+		ASSERT(bmp, "Failed. Bitmap was nullptr!");
+		auto bmpData = (BitmapData*)(bmp);
+
+		if (!alpha || rect.w <= 0 || rect.h <= 0)
+			return;
+
+		SDL_FRect dstRect{ (float)rect.x, (float)rect.y, (float)rect.w, (float)rect.h };
+
+		QueueFill(bmpData, dstRect, ToFColor(c, alpha), SDL_BLENDMODE_BLEND);
+	}
+
+	void BitmapFlush(Bitmap bmp)
+	{
+		ASSERT(bmp, "Failed. Bitmap was nullptr!");
+		FlushBlits((BitmapData*)(bmp));
 	}
 
 	void BitmapAccessPixels(Bitmap bmp, const BitmapAccessFunctor& func)
@@ -24,6 +24,9 @@ namespace gfx
 
 	bool		BitmapLock(Bitmap bmp);
 	void		BitmapUnlock(Bitmap bmp);
+	// Only pixels inside rect are synced from the GPU and uploaded back on
+	// unlock; the memory is still addressed in whole-bitmap coordinates.
+	bool		BitmapLockRect(Bitmap bmp, const Rect& rect);
 	PixelMemory	BitmapGetMemory(Bitmap bmp);
 	int			BitmapGetLineOffset(Bitmap bmp);
 
@@ -35,6 +38,8 @@ namespace gfx
 	// Makes all pixels matching the RGB color transparent (alpha = 0)
 	void	BitmapSetColorKey(Bitmap bmp, RGBValue r, RGBValue g, RGBValue b);
 
+	// Blits are deferred: they are queued per destination and replayed in
+	// batches on gfx::Flush, or earlier whenever the destination gets read.
 	void BitmapBlit(
 		Bitmap src, const Rect& from,
 		Bitmap dest, const Point& to
@@ -51,6 +56,15 @@ namespace gfx
 		Bitmap dest, const Rect& to
 	);
 
+	// Overwrites rect with c, alpha included
+	void BitmapFillRect(Bitmap bmp, const Rect& rect, Color c);
+
+	// Blends c over rect with the given alpha, the alpha channel of c is ignored
+	void BitmapFillRectBlended(Bitmap bmp, const Rect& rect, Color c, Alpha alpha);
+
+	// Submits the blits still queued into bmp
+	void BitmapFlush(Bitmap bmp);
+
 	using BitmapAccessFunctor = std::function<bool(PixelMemory)>;
 	void BitmapAccessPixels(Bitmap bmp, const BitmapAccessFunctor& func);
 
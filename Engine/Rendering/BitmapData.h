@@ -0,0 +1,38 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+// Internal to the gfx layer: the concrete object behind the opaque gfx::Bitmap
+// handle. Only Rendering/*.cpp should include this header.
+
+namespace gfx
+{
+	struct BitmapData
+	{
+		SDL_Surface* surf = nullptr;
+		SDL_Texture* texture = nullptr;
+		int isDirty = 0;
+		SDL_Rect dirtyRect = { 0, 0, 0, 0 };	// texture area newer than surf, valid while isDirty
+		SDL_Rect lockRect = { 0, 0, 0, 0 };	// surface area uploaded again on unlock
+
+		// Blit queue bookkeeping (see Rendering/BlitQueue.h)
+		int queueSlot = -1;		// batch index while blits into this bitmap are pending
+		int sampledCount = 0;	// pending blits that read from this bitmap
+	};
+
+	// Records that the GPU copy of the bitmap changed inside area
+	inline void MarkBitmapDirty(BitmapData* bmp, const SDL_Rect& area)
+	{
+		SDL_Rect bounds{ 0, 0, bmp->surf->w, bmp->surf->h };
+		SDL_Rect clipped;
+		if (!SDL_GetRectIntersection(&area, &bounds, &clipped))
+			return;
+
+		if (bmp->isDirty)
+			SDL_GetRectUnion(&bmp->dirtyRect, &clipped, &bmp->dirtyRect);
+		else
+			bmp->dirtyRect = clipped;
+
+		bmp->isDirty = 1;
+	}
+}
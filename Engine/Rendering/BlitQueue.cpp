@@ -0,0 +1,284 @@
+#include "Rendering/BlitQueue.h"
+#include "Utils/Assert.h"
+
+#include <cmath>
+#include <vector>
+#include <utility>
+
+namespace gfx
+{
+	extern SDL_Renderer* g_pRenderer;
+
+	struct BlitCommand
+	{
+		SDL_Texture* src;
+		float		 u0, v0, u1, v1;
+		SDL_FRect	 to;
+		SDL_FColor	 color;
+		SDL_BlendMode blend;	// only used by fills, textures carry their own
+		BitmapData*	 srcData;	// nullptr for fills
+	};
+
+	struct BlitBatch
+	{
+		BitmapData*				 dest = nullptr;
+		std::vector<BlitCommand> commands;
+	};
+
+	// Batches are recycled between frames so their command vectors keep capacity
+	static std::vector<BlitBatch>	s_Batches;
+	static int						s_ActiveBatches = 0;
+	static std::vector<SDL_Vertex>	s_Vertices;
+	static std::vector<int>			s_Indices;
+	static SDL_Texture*				s_BoundTarget = nullptr;
+	static FrameStats				s_FrameStats;
+}
+
+namespace gfx
+{
+	auto CurrentFrameStats(void) -> FrameStats&
+	{
+		return s_FrameStats;
+	}
+
+	void BindRenderTarget(SDL_Texture* target)
+	{
+		if (s_BoundTarget == target)
+			return;
+
+		ASSERT(SDL_SetRenderTarget(
+			g_pRenderer,
+			target
+		), SDL_GetError());
+
+		s_BoundTarget = target;
+		++s_FrameStats.targetSwitches;
+	}
+
+	void ReleaseRenderTarget(SDL_Texture* target)
+	{
+		if (s_BoundTarget == target)
+			BindRenderTarget(nullptr);
+	}
+
+	static inline void ReleaseSources(BlitBatch& batch)
+	{
+		for (auto& cmd : batch.commands)
+			if (cmd.srcData)
+				--cmd.srcData->sampledCount;
+		batch.commands.clear();
+	}
+
+	static void RemoveBatch(int slot)
+	{
+		ASSERT(slot >= 0 && slot < s_ActiveBatches, "Invalid blit batch slot!");
+
+		s_Batches[slot].dest->queueSlot = -1;
+		s_Batches[slot].dest = nullptr;
+
+		int last = --s_ActiveBatches;
+		if (slot != last)
+		{
+			std::swap(s_Batches[slot], s_Batches[last]);
+			s_Batches[slot].dest->queueSlot = slot;
+		}
+	}
+
+	static inline void AppendQuad(const BlitCommand& cmd)
+	{
+		const SDL_FColor& color = cmd.color;
+		const float x0 = cmd.to.x, y0 = cmd.to.y;
+		const float x1 = cmd.to.x + cmd.to.w, y1 = cmd.to.y + cmd.to.h;
+
+		int base = (int)s_Vertices.size();
+		s_Vertices.push_back({ { x0, y0 }, color, { cmd.u0, cmd.v0 } });
+		s_Vertices.push_back({ { x1, y0 }, color, { cmd.u1, cmd.v0 } });
+		s_Vertices.push_back({ { x1, y1 }, color, { cmd.u1, cmd.v1 } });
+		s_Vertices.push_back({ { x0, y1 }, color, { cmd.u0, cmd.v1 } });
+
+		s_Indices.push_back(base + 0);
+		s_Indices.push_back(base + 1);
+		s_Indices.push_back(base + 2);
+		s_Indices.push_back(base + 0);
+		s_Indices.push_back(base + 2);
+		s_Indices.push_back(base + 3);
+	}
+
+	static void SubmitRun(SDL_Texture* src, SDL_BlendMode blend)
+	{
+		if (s_Indices.empty())
+			return;
+
+		if (!src)
+			ASSERT(SDL_SetRenderDrawBlendMode(
+				g_pRenderer,
+				blend
+			), SDL_GetError());
+
+		ASSERT(SDL_RenderGeometry(
+			g_pRenderer,
+			src,
+			s_Vertices.data(),
+			(int)s_Vertices.size(),
+			s_Indices.data(),
+			(int)s_Indices.size()
+		), SDL_GetError());
+
+		++s_FrameStats.drawCalls;
+		s_Vertices.clear();
+		s_Indices.clear();
+	}
+
+	static void ReplayBatch(BlitBatch& batch)
+	{
+		if (batch.commands.empty())
+			return;
+
+		BindRenderTarget(batch.dest->texture);
+
+		// Only consecutive blits may be merged, reordering would break overdraw
+		SDL_Texture* runSrc = batch.commands.front().src;
+		SDL_BlendMode runBlend = batch.commands.front().blend;
+		for (auto& cmd : batch.commands)
+		{
+			if (cmd.src != runSrc || cmd.blend != runBlend)
+			{
+				SubmitRun(runSrc, runBlend);
+				runSrc = cmd.src;
+				runBlend = cmd.blend;
+			}
+			AppendQuad(cmd);
+		}
+		SubmitRun(runSrc, runBlend);
+
+		// Screen level fills expect the default draw blend mode
+		ASSERT(SDL_SetRenderDrawBlendMode(
+			g_pRenderer,
+			SDL_BLENDMODE_BLEND
+		), SDL_GetError());
+
+		ReleaseSources(batch);
+	}
+
+	static auto AcquireBatch(BitmapData* dest) -> BlitBatch&
+	{
+		if (dest->queueSlot < 0)
+		{
+			if (s_ActiveBatches == (int)s_Batches.size())
+				s_Batches.emplace_back();
+
+			dest->queueSlot = s_ActiveBatches++;
+			s_Batches[dest->queueSlot].dest = dest;
+		}
+		return s_Batches[dest->queueSlot];
+	}
+
+	static inline SDL_Rect TouchedRect(const SDL_FRect& to)
+	{
+		int x0 = (int)std::floor(to.x);
+		int y0 = (int)std::floor(to.y);
+		return { x0, y0, (int)std::ceil(to.x + to.w) - x0, (int)std::ceil(to.y + to.h) - y0 };
+	}
+
+	void QueueBlit(BitmapData* src, const SDL_FRect& from, BitmapData* dest, const SDL_FRect& to, SDL_FlipMode flip)
+	{
+		ASSERT(src && dest, "Failed. Blit bitmap was nullptr!");
+		ASSERT(src != dest, "Failed. Blitting a bitmap onto itself is not supported!");
+
+		PrepareBitmapRead(src);
+		PrepareBitmapWrite(dest);
+
+		auto& batch = AcquireBatch(dest);
+
+		const float texW = (float)src->surf->w;
+		const float texH = (float)src->surf->h;
+
+		BlitCommand cmd;
+		cmd.src = src->texture;
+		cmd.srcData = src;
+		cmd.to = to;
+		cmd.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		cmd.blend = SDL_BLENDMODE_BLEND;
+		cmd.u0 = from.x / texW;
+		cmd.v0 = from.y / texH;
+		cmd.u1 = (from.x + from.w) / texW;
+		cmd.v1 = (from.y + from.h) / texH;
+
+		if (flip & SDL_FLIP_HORIZONTAL)
+			std::swap(cmd.u0, cmd.u1);
+		if (flip & SDL_FLIP_VERTICAL)
+			std::swap(cmd.v0, cmd.v1);
+
+		batch.commands.push_back(cmd);
+		++src->sampledCount;
+		++s_FrameStats.blits;
+
+		MarkBitmapDirty(dest, TouchedRect(to));
+	}
+
+	void QueueFill(BitmapData* dest, const SDL_FRect& to, const SDL_FColor& color, SDL_BlendMode blend)
+	{
+		ASSERT(dest, "Failed. Fill bitmap was nullptr!");
+
+		PrepareBitmapWrite(dest);
+		auto& batch = AcquireBatch(dest);
+
+		BlitCommand cmd;
+		cmd.src = nullptr;
+		cmd.srcData = nullptr;
+		cmd.to = to;
+		cmd.color = color;
+		cmd.blend = blend;
+		cmd.u0 = cmd.v0 = cmd.u1 = cmd.v1 = 0.0f;
+
+		batch.commands.push_back(cmd);
+		++s_FrameStats.blits;
+
+		MarkBitmapDirty(dest, TouchedRect(to));
+	}
+
+	void FlushBlits(BitmapData* dest)
+	{
+		ASSERT(dest, "Failed. Bitmap was nullptr!");
+		if (dest->queueSlot < 0)
+			return;
+
+		int slot = dest->queueSlot;
+		ReplayBatch(s_Batches[slot]);
+		RemoveBatch(slot);
+	}
+
+	void FlushAllBlits(void)
+	{
+		for (int i = 0; i < s_ActiveBatches; ++i)
+		{
+			ReplayBatch(s_Batches[i]);
+			s_Batches[i].dest->queueSlot = -1;
+			s_Batches[i].dest = nullptr;
+		}
+		s_ActiveBatches = 0;
+	}
+
+	void DiscardBlits(BitmapData* dest)
+	{
+		ASSERT(dest, "Failed. Bitmap was nullptr!");
+		if (dest->queueSlot < 0)
+			return;
+
+		int slot = dest->queueSlot;
+		ReleaseSources(s_Batches[slot]);
+		RemoveBatch(slot);
+	}
+
+	void PrepareBitmapRead(BitmapData* bmp)
+	{
+		FlushBlits(bmp);
+	}
+
+	void PrepareBitmapWrite(BitmapData* bmp)
+	{
+		// Some pending blit still reads the old contents
+		if (bmp->sampledCount > 0)
+			FlushAllBlits();
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Rendering/BitmapData.h"
+#include "Rendering/Renderer.h"
+
+// Deferred blit queue. Blits are recorded per destination bitmap and replayed
+// with a single render target bind, one SDL_RenderGeometry call per run of
+// consecutive blits sharing a source texture (fills count as a null texture). Submission order is preserved
+// within a destination; cross-bitmap hazards are resolved by flushing early:
+//  - reading a bitmap (as blit source or through a lock) flushes its own queue,
+//  - writing a bitmap that pending blits still sample flushes everything.
+
+namespace gfx
+{
+	void QueueBlit(
+		BitmapData* src, const SDL_FRect& from,
+		BitmapData* dest, const SDL_FRect& to,
+		SDL_FlipMode flip
+	);
+
+	// Solid quad drawn over dest with the given blend mode (NONE replaces the
+	// pixels), ordered together with the blits
+	void QueueFill(BitmapData* dest, const SDL_FRect& to, const SDL_FColor& color, SDL_BlendMode blend);
+
+	void FlushBlits(BitmapData* dest);
+	void FlushAllBlits(void);
+	void DiscardBlits(BitmapData* dest);
+
+	// Must be called before the CPU or the renderer reads/overwrites a bitmap
+	void PrepareBitmapRead(BitmapData* bmp);
+	void PrepareBitmapWrite(BitmapData* bmp);
+
+	// Cached SDL_SetRenderTarget, counts actual target switches
+	void BindRenderTarget(SDL_Texture* target);
+	void ReleaseRenderTarget(SDL_Texture* target);
+
+	// Counters of the frame being built, snapshot and reset by gfx::Flush
+	auto CurrentFrameStats(void) -> FrameStats&;
+}
@@ -1,4 +1,6 @@
 #include "Rendering/Renderer.h"
+#include "Rendering/BitmapData.h"
+#include "Rendering/BlitQueue.h"
 #include "Rendering/Color.h"
 #include "Utils/Assert.h"
 
@@ -11,20 +13,17 @@ namespace gfx
 	const SDL_PixelFormatDetails* g_pSuportedPixelFormat = nullptr;
 	Color						  g_ClearColor;
 
-	struct BitmapData
-	{
-		SDL_Surface* surf = nullptr;
-		SDL_Texture* texture = nullptr;
-		int isDirty = 0;
-	};
-
 	struct ViewData
 	{
 		bool   dpyChanged = false;
 		Dim	   dpyX = 0, dpyY = 0;
 		Dim	   bufX = 0, bufY = 0;
 		Bitmap buffer = nullptr;
+		Color  fadeColor = 0;
+		Alpha  fadeAlpha = 0;
 	} g_ViewData;
+
+	static FrameStats s_LastFrameStats;
 }
 
 namespace gfx
@@ -52,6 +51,11 @@ namespace gfx
 
 		g_ClearColor = MakeColor(255, 255, 255, 255);
 
+		ASSERT(SDL_SetRenderDrawBlendMode(
+			g_pRenderer,
+			SDL_BLENDMODE_BLEND
+		), SDL_GetError());
+
 		g_ViewData.dpyX = rw;
 		g_ViewData.dpyY = rh;
 	}
@@ -114,6 +118,12 @@ namespace gfx
 		return { 0, 0, g_ViewData.bufX, g_ViewData.bufY };
 	}
 
+	void SetScreenFade(Color c, Alpha alpha)
+	{
+		g_ViewData.fadeColor = c;
+		g_ViewData.fadeAlpha = alpha;
+	}
+
 	void RaiseWindowResizeEvent(void)
 	{
 		g_ViewData.dpyChanged = true;
@@ -143,10 +153,8 @@ namespace gfx
 		auto bufferData = (BitmapData*)(g_ViewData.buffer);
 		auto bufferTexture = bufferData->texture;
 
-		ASSERT(SDL_SetRenderTarget(
-			g_pRenderer, 
-			nullptr
-		), SDL_GetError());
+		FlushAllBlits();
+		BindRenderTarget(nullptr);
 
 		ASSERT(SDL_RenderClear(
 			g_pRenderer
@@ -159,8 +167,47 @@ namespace gfx
 			nullptr
 		), SDL_GetError());
 
+		if (g_ViewData.fadeAlpha)
+		{
+			Color c = g_ViewData.fadeColor;
+			ASSERT(SDL_SetRenderDrawColor(
+				g_pRenderer,
+				(Uint8)((c & GetRedBitMaskRGBA()) >> GetRedShiftRGBA()),
+				(Uint8)((c & GetGreenBitMaskRGBA()) >> GetGreenShiftRGBA()),
+				(Uint8)((c & GetBlueBitMaskRGBA()) >> GetBlueShiftRGBA()),
+				g_ViewData.fadeAlpha
+			), SDL_GetError());
+
+			ASSERT(SDL_RenderFillRect(
+				g_pRenderer,
+				nullptr
+			), SDL_GetError());
+
+			// RenderClear uses the draw color too
+			ASSERT(SDL_SetRenderDrawColor(
+				g_pRenderer,
+				0, 0, 0, 255
+			), SDL_GetError());
+
+			++CurrentFrameStats().drawCalls;
+		}
+
 		ASSERT(SDL_RenderPresent(
 			g_pRenderer
 		), SDL_GetError());
+
+		s_LastFrameStats = CurrentFrameStats();
+		CurrentFrameStats() = FrameStats{};
+	}
+
+	bool SetVSync(bool on)
+	{
+		ASSERT((g_pRenderer), "Renderer is not initialized!");
+		return SDL_SetRenderVSync(g_pRenderer, on ? 1 : SDL_RENDERER_VSYNC_DISABLED);
+	}
+
+	FrameStats GetFrameStats(void)
+	{
+		return s_LastFrameStats;
 	}
 }
\ No newline at end of file
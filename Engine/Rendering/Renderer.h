@@ -5,6 +5,13 @@
 
 namespace gfx
 {
+	struct FrameStats
+	{
+		unsigned targetSwitches = 0;
+		unsigned drawCalls = 0;
+		unsigned blits = 0;
+	};
+
 	void Open(const char* title, Dim rw, Dim rh);
 	void Close(void);
 	Dim	 GetResWidth(void);
@@ -17,7 +24,17 @@ namespace gfx
 	Bitmap GetScreenBuffer(void);
 	Rect   GetScreenRect(void);
 
+	// Whole-screen tint blended on top of the screen buffer by Flush,
+	// stays active until it is reset with zero alpha
+	void SetScreenFade(Color c, Alpha alpha);
+
 	void RaiseWindowResizeEvent(void);
 
 	void Flush(void);
+
+	// Makes Flush wait for the display refresh; false if the driver refuses
+	bool SetVSync(bool on);
+
+	// Counters of the last flushed frame
+	FrameStats GetFrameStats(void);
 }
\ No newline at end of file
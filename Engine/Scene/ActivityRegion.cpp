@@ -0,0 +1,199 @@
+#include "Scene/ActivityRegion.h"
+#include "Scene/Sprite.h"
+#include "Animations/Animator.h"
+#include "Core/SystemClock.h"
+#include "Utils/Assert.h"
+
+namespace scene
+{
+	void ActivityRegion::SetMargin(int px)
+	{
+		ASSERT(px >= 0, "Activity margin must not be negative");
+		m_Margin = px;
+	}
+
+	void ActivityRegion::Add(Sprite* s, anim::Animator* a, const Ticker& tick)
+	{
+		ASSERT(s, "Null sprite added to the activity region");
+		ASSERT(!m_Entries.count(s), "Sprite already in the activity region");
+
+		Entry& e = m_Entries[s];
+		e.sprite = s;
+		e.animator = a;
+		e.tick = tick;
+		e.cell = CellOf(s);
+		Bucket(&e);
+
+		e.awakeSlot = m_Awake.size();
+		m_Awake.push_back(&e);
+	}
+
+	void ActivityRegion::Remove(Sprite* s)
+	{
+		auto i = m_Entries.find(s);
+		if (i == m_Entries.end())
+			return;
+
+		Entry* e = &i->second;
+		if (e->awakeSlot == SIZE_MAX)
+		{
+			// Hand the animator back to the manager in the state it was parked in
+			if (e->animator)
+				e->animator->Wake(core::SystemClock::Get().GetCurrTime());
+		}
+		else
+			DropAwake(e);
+
+		Unbucket(e);
+		m_Entries.erase(i);
+	}
+
+	void ActivityRegion::Clear(void)
+	{
+		TimeStamp t = core::SystemClock::Get().GetCurrTime();
+		for (auto& [sprite, e] : m_Entries)
+			if (e.awakeSlot == SIZE_MAX && e.animator)
+				e.animator->Wake(t);
+
+		m_Entries.clear();
+		m_Cells.clear();
+		m_Awake.clear();
+		m_Range = CellRange{};
+	}
+
+	void ActivityRegion::Update(const Rect& view)
+	{
+		CellRange range;
+		range.x1 = CellCoord(view.x - m_Margin);
+		range.y1 = CellCoord(view.y - m_Margin);
+		range.x2 = CellCoord(view.x + view.w - 1 + m_Margin);
+		range.y2 = CellCoord(view.y + view.h - 1 + m_Margin);
+
+		TimeStamp t = core::SystemClock::Get().GetCurrTime();
+
+		// Awake objects may have walked across a cell border since last frame;
+		// rebucket them first so the transitions below see where they are now
+		for (Entry* e : m_Awake)
+		{
+			uint64_t cell = CellOf(e->sprite);
+			if (cell != e->cell)
+			{
+				Unbucket(e);
+				e->cell = cell;
+				Bucket(e);
+			}
+		}
+
+		// Cells the region just left or reached; sleepers never move, so their
+		// bucket is still where they fell asleep
+		ForEachIn(m_Range, range, [this, t](Entry* e) { SleepEntry(e, t); });
+		ForEachIn(range, m_Range, [this, t](Entry* e) { WakeEntry(e, t); });
+		m_Range = range;
+
+		// Objects that walked out of reach on their own. Backwards, since
+		// sleeping swaps the last entry into the freed slot.
+		for (size_t i = m_Awake.size(); i-- > 0;)
+		{
+			Entry* e = m_Awake[i];
+			int cx = static_cast<int32_t>(e->cell >> 32);
+			int cy = static_cast<int32_t>(e->cell & 0xFFFFFFFFu);
+			if (!m_Range.Contains(cx, cy))
+				SleepEntry(e, t);
+		}
+	}
+
+	void ActivityRegion::Tick(void)
+	{
+		for (size_t i = 0; i < m_Awake.size(); ++i)
+			if (m_Awake[i]->tick)
+				m_Awake[i]->tick();
+	}
+
+	bool ActivityRegion::IsAwake(const Sprite* s) const
+	{
+		auto i = m_Entries.find(s);
+		return i != m_Entries.end() && i->second.awakeSlot != SIZE_MAX;
+	}
+
+	uint64_t ActivityRegion::CellKey(int cx, int cy)
+	{
+		return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+	}
+
+	uint64_t ActivityRegion::CellOf(const Sprite* s) const
+	{
+		const Rect box = s->GetBox();
+		return CellKey(CellCoord(box.x + box.w / 2), CellCoord(box.y + box.h / 2));
+	}
+
+	void ActivityRegion::Bucket(Entry* e)
+	{
+		m_Cells[e->cell].push_back(e);
+	}
+
+	void ActivityRegion::Unbucket(Entry* e)
+	{
+		auto i = m_Cells.find(e->cell);
+		ASSERT(i != m_Cells.end(), "Activity entry missing from its cell");
+
+		auto& list = i->second;
+		for (auto& slot : list)
+			if (slot == e)
+			{
+				slot = list.back();
+				list.pop_back();
+				break;
+			}
+		if (list.empty())
+			m_Cells.erase(i);
+	}
+
+	void ActivityRegion::DropAwake(Entry* e)
+	{
+		Entry* last = m_Awake.back();
+		m_Awake[e->awakeSlot] = last;
+		last->awakeSlot = e->awakeSlot;
+		m_Awake.pop_back();
+		e->awakeSlot = SIZE_MAX;
+	}
+
+	void ActivityRegion::SleepEntry(Entry* e, TimeStamp t)
+	{
+		if (e->awakeSlot == SIZE_MAX)
+			return;
+
+		DropAwake(e);
+		if (e->animator)
+			e->animator->Sleep(t);
+	}
+
+	void ActivityRegion::WakeEntry(Entry* e, TimeStamp t)
+	{
+		if (e->awakeSlot != SIZE_MAX)
+			return;
+
+		e->awakeSlot = m_Awake.size();
+		m_Awake.push_back(e);
+
+		if (e->animator)
+			e->animator->Wake(t);
+	}
+
+	void ActivityRegion::ForEachIn(const CellRange& r, const CellRange& skip, const std::function<void(Entry*)>& f)
+	{
+		for (int cy = r.y1; cy <= r.y2; ++cy)
+			for (int cx = r.x1; cx <= r.x2; ++cx)
+			{
+				if (skip.Contains(cx, cy))
+					continue;
+
+				auto i = m_Cells.find(CellKey(cx, cy));
+				if (i == m_Cells.end())
+					continue;
+
+				// Waking or sleeping never rebuckets, so the list is stable here
+				for (Entry* e : i->second)
+					f(e);
+			}
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Utils/Common.h"
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace anim
+{
+	class Animator;
+}
+
+namespace scene
+{
+	class Sprite;
+
+	// Keeps only the objects around the camera alive, like the Genesis object
+	// manager. Sprites are bucketed into coarse world cells; when the view plus
+	// a margin stops covering a cell, its objects fall asleep (no ticks, their
+	// animator parked) and wake up when the region comes back over them. Work
+	// per frame follows the cells entering or leaving the region and the awake
+	// objects, never the whole level population.
+	class ActivityRegion final
+	{
+	public:
+		using Ticker = std::function<void(void)>;
+
+		static constexpr int DEFAULT_MARGIN_PX = 128;
+		static constexpr int CELL_SHIFT = 8;	// 256 px cells
+
+		void SetMargin(int px);
+
+		// Objects start awake and settle on the next Update. The animator, if
+		// any, must outlive the registration.
+		void Add(Sprite* s, anim::Animator* a = nullptr, const Ticker& tick = nullptr);
+		void Remove(Sprite* s);
+		void Clear(void);
+
+		// Once per frame with the visible area in world pixels
+		void Update(const Rect& view);
+
+		// Runs the ticker of every awake object; tickers must not Add or Remove
+		void Tick(void);
+
+		bool IsAwake(const Sprite* s) const;
+		auto GetAwakeCount(void) const -> size_t { return m_Awake.size(); }
+
+		ActivityRegion(void) = default;
+		ActivityRegion(const ActivityRegion&) = delete;
+		ActivityRegion& operator=(const ActivityRegion&) = delete;
+
+	private:
+		struct Entry
+		{
+			Sprite*			sprite = nullptr;
+			anim::Animator* animator = nullptr;
+			Ticker			tick;
+			uint64_t		cell = 0;
+			size_t			awakeSlot = SIZE_MAX;	// index in m_Awake, SIZE_MAX when asleep
+		};
+
+		struct CellRange
+		{
+			int x1 = 0, y1 = 0, x2 = -1, y2 = -1;	// inclusive, empty by default
+			bool Contains(int cx, int cy) const { return cx >= x1 && cx <= x2 && cy >= y1 && cy <= y2; }
+		};
+
+		static uint64_t CellKey(int cx, int cy);
+		static int CellCoord(int px) { return px >> CELL_SHIFT; }	// arithmetic shift floors negatives
+		uint64_t CellOf(const Sprite* s) const;
+
+		void Bucket(Entry* e);
+		void Unbucket(Entry* e);
+		void DropAwake(Entry* e);
+		void SleepEntry(Entry* e, TimeStamp t);
+		void WakeEntry(Entry* e, TimeStamp t);
+		void ForEachIn(const CellRange& r, const CellRange& skip, const std::function<void(Entry*)>& f);
+
+	private:
+		int m_Margin = DEFAULT_MARGIN_PX;
+		CellRange m_Range;
+
+		std::unordered_map<const Sprite*, Entry>		m_Entries;	// node based, Entry* stays valid
+		std::unordered_map<uint64_t, std::vector<Entry*>> m_Cells;
+		std::vector<Entry*>							m_Awake;
+	};
+}
@@ -1,15 +1,140 @@
 #include "Scene/GridLayer.h"
 #include "Scene/TileLayer.h"
+#include "IO/MappedFile.h"
+#include "IO/CsvReader.h"
+#include "Rendering/stb_image.h"
 #include "Utils/Assert.h"
 
-#include <sstream>
 #include <string>
 #include <fstream>
 #include <cstdint>
+#include <climits>
 #include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
 
 namespace scene
 {
+	// GRLE v2 layout, native (little) endian:
+	//   header     'GRLE', version, cols, rows, chunk size, chunk cols, chunk rows, reserved
+	//   directory  one RleChunkEntry per chunk, row major
+	//   data       per chunk, runs of { uint8 value, uint16 count } over all
+	//              GRID_CHUNK_SIZE^2 cells, cells past the grid edge are empty
+	// Identical chunks share their data, uniform chunks have none at all.
+	struct GridMap::RleChunkEntry
+	{
+		uint32_t offset;	// from the start of the file
+		uint16_t runs;		// 0 for a uniform chunk
+		uint8_t  fill;		// value of a uniform chunk
+		uint8_t  reserved;
+	};
+
+	static constexpr size_t GRLE_V1_HEADER_SIZE = 16;
+	static constexpr size_t GRLE_V2_HEADER_SIZE = 32;
+	static constexpr size_t GRLE_V2_RUN_SIZE = 3;
+	static constexpr size_t GRID_CHUNK_CELLS = GRID_CHUNK_SIZE * GRID_CHUNK_SIZE;
+
+	// Cap of the wall distance field, one nibble. Anything farther is past the
+	// 8 pixel push out limit even on a 1x1 grid.
+	static constexpr int WALL_FIELD_MAX = 15;
+
+	static inline uint32_t ReadU32(const byte* p)
+	{
+		uint32_t value;
+		memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	// Shares identical chunks while a grid is being loaded
+	class GridMap::ChunkInterner
+	{
+	public:
+		ChunkPtr Intern(const GridChunk& chunk)
+		{
+			if (IsUniform(chunk, GRID_EMPTY_TILE))
+				return EmptyChunk();
+			if (IsUniform(chunk, GRID_SOLID_TILE))
+				return SolidChunk();
+
+			auto& bucket = m_Chunks[Hash(chunk)];
+			for (auto& other : bucket)
+				if (!memcmp(other->cells, chunk.cells, sizeof(chunk.cells)))
+					return other;
+
+			bucket.push_back(std::make_shared<GridChunk>(chunk));
+			return bucket.back();
+		}
+
+	private:
+		static bool IsUniform(const GridChunk& chunk, GridCell value)
+		{
+			for (auto cell : chunk.cells)
+				if (cell != value)
+					return false;
+			return true;
+		}
+
+		static uint64_t Hash(const GridChunk& chunk)
+		{
+			uint64_t h = 14695981039346656037ull;	// FNV-1a
+			for (auto cell : chunk.cells)
+				h = (h ^ cell) * 1099511628211ull;
+			return h;
+		}
+
+		std::unordered_map<uint64_t, std::vector<ChunkPtr>> m_Chunks;
+	};
+
+	/*static*/ auto GridMap::EmptyChunk(void) -> const ChunkPtr&
+	{
+		static const ChunkPtr s_Empty = []
+		{
+			auto chunk = std::make_shared<GridChunk>();
+			std::fill(std::begin(chunk->cells), std::end(chunk->cells), (GridCell)GRID_EMPTY_TILE);
+			return chunk;
+		}();
+		return s_Empty;
+	}
+
+	/*static*/ auto GridMap::SolidChunk(void) -> const ChunkPtr&
+	{
+		static const ChunkPtr s_Solid = []
+		{
+			auto chunk = std::make_shared<GridChunk>();
+			std::fill(std::begin(chunk->cells), std::end(chunk->cells), (GridCell)GRID_SOLID_TILE);
+			return chunk;
+		}();
+		return s_Solid;
+	}
+
+	GridMap::GridMap(void) = default;
+	GridMap::~GridMap() = default;
+
+	void GridMap::StoreChunkRow(Dim chunkRow, const GridCell* cells, ChunkInterner& interner)
+	{
+		// cells holds GRID_CHUNK_SIZE full grid rows starting at the chunk row
+		Dim rows = std::min<Dim>(GRID_CHUNK_SIZE, m_gridRows - chunkRow * GRID_CHUNK_SIZE);
+
+		for (Dim chunkCol = 0; chunkCol < m_chunkCols; ++chunkCol)
+		{
+			GridChunk chunk;
+			std::fill(std::begin(chunk.cells), std::end(chunk.cells), (GridCell)GRID_EMPTY_TILE);	// padding past the grid edge
+
+			Dim col0 = chunkCol * GRID_CHUNK_SIZE;
+			Dim cols = std::min<Dim>(GRID_CHUNK_SIZE, m_gridCols - col0);
+
+			for (Dim y = 0; y < rows; ++y)
+				memcpy(&chunk.cells[y * GRID_CHUNK_SIZE], cells + (size_t)y * m_gridCols + col0, cols);
+
+			m_chunks[(size_t)chunkRow * m_chunkCols + chunkCol] = interner.Intern(chunk);
+		}
+	}
+
 	void GridMap::Configure(GridConfig cfg)
 	{
 		ASSERT(
@@ -18,10 +143,25 @@ namespace scene
 		);
 
 		m_config = cfg;
-		m_grid.resize(
-			(m_config.totalCols * m_config.totalRows * GridElementsPerTile()), 
-			GRID_THIN_AIR_MASK
+		m_gridCols = m_config.totalCols * GridBlockColumns();
+		m_gridRows = m_config.totalRows * GridBlockRows();
+		m_chunkCols = (m_gridCols + GRID_CHUNK_MASK) >> GRID_CHUNK_SHIFT;
+		m_chunkRows = (m_gridRows + GRID_CHUNK_MASK) >> GRID_CHUNK_SHIFT;
+		ResetChunks();
+	}
+
+	void GridMap::ResetChunks(void)
+	{
+		ASSERT(!m_sourceKept, "Failed. Stop the level streamer before reloading the grid!");
+
+		ReleaseSource();
+		m_chunks.assign(
+			(size_t)m_chunkCols * m_chunkRows, 
+			EmptyChunk()
 		);
+		m_chunkEdited.assign(m_chunks.size(), false);
+		InvalidateSurfaceIndex();
+		InvalidateWallFields();
 	}
 
 	const GridConfig& GridMap::Config() const
@@ -54,6 +194,211 @@ namespace scene
 		r.x -= *dx;
 	}
 
+	static inline int FloorDiv(int a, int b)
+	{
+		return a >= 0 ? a / b : -((-a + b - 1) / b);
+	}
+
+	static inline int FloorDiv(double a, int b)
+	{
+		return (int)std::floor(a / b);
+	}
+
+	bool GridMap::IsColumnBlocked(int col, int row0, int row1, GridIndex mask)
+	{
+		if (col < 0 || col >= m_gridCols)
+			return false;	// Out of bounds = empty/passable
+
+		row0 = std::max(row0, 0);
+		row1 = std::min(row1, m_gridRows - 1);
+		for (int row = row0; row <= row1; ++row)
+			if (Cell(col, row) & mask)
+				return true;
+		return false;
+	}
+
+	bool GridMap::IsRowBlocked(int row, int col0, int col1, GridIndex mask)
+	{
+		if (row < 0 || row >= m_gridRows)
+			return false;	// Out of bounds = empty/passable
+
+		col0 = std::max(col0, 0);
+		col1 = std::min(col1, m_gridCols - 1);
+		for (int col = col0; col <= col1; ++col)
+			if (Cell(col, row) & mask)
+				return true;
+		return false;
+	}
+
+	SweepHit GridMap::SweepAABB(const Rect& r, int dx, int dy, GridIndex mask)
+	{
+		SweepHit result;
+		result.dx = dx;
+		result.dy = dy;
+
+		if (r.w <= 0 || r.h <= 0 || (!dx && !dy))
+			return result;
+
+		const int ew = m_config.gridElementWidth;
+		const int eh = m_config.gridElementHeight;
+		const int x1 = r.x, y1 = r.y;
+		const int x2 = r.x + r.w - 1, y2 = r.y + r.h - 1;
+		const int stepX = number_sign(dx), stepY = number_sign(dy);
+
+		// Next column/row entered by the leading edges and the distance the edge
+		// travels to reach it, signed like the displacement
+		int col = stepX > 0 ? FloorDiv(x2, ew) + 1 : FloorDiv(x1, ew) - 1;
+		int row = stepY > 0 ? FloorDiv(y2, eh) + 1 : FloorDiv(y1, eh) - 1;
+		auto reachX = [=](int c) { return stepX > 0 ? c * ew - x2 : (c + 1) * ew - 1 - x1; };
+		auto reachY = [=](int r) { return stepY > 0 ? r * eh - y2 : (r + 1) * eh - 1 - y1; };
+
+		// Times of the next crossing on each axis, > 1 means not within this move
+		double tX = stepX ? (double)reachX(col) / dx : 2.0;
+		double tY = stepY ? (double)reachY(row) / dy : 2.0;
+
+		// Visit crossings in time order, each one only looks at the cells just entered
+		while (tX <= 1.0 || tY <= 1.0)
+		{
+			if (tX <= tY)
+			{
+				int row0 = FloorDiv(y1 + dy * tX, eh);
+				int row1 = FloorDiv(y2 + dy * tX, eh);
+				if (IsColumnBlocked(col, row0, row1, mask))
+				{
+					result = { true, (float)tX, -stepX, 0, reachX(col) - stepX, (int)(dy * tX) };
+					return result;
+				}
+				col += stepX;
+				tX = (double)reachX(col) / dx;
+			}
+			else
+			{
+				int col0 = FloorDiv(x1 + dx * tY, ew);
+				int col1 = FloorDiv(x2 + dx * tY, ew);
+				if (IsRowBlocked(row, col0, col1, mask))
+				{
+					result = { true, (float)tY, 0, -stepY, (int)(dx * tY), reachY(row) - stepY };
+					return result;
+				}
+				row += stepY;
+				tY = (double)reachY(row) / dy;
+			}
+		}
+
+		return result;
+	}
+
+	RayHit GridMap::Raycast(float x, float y, float dirX, float dirY, float maxDist, GridIndex mask)
+	{
+		return Raycast(Ray{ x, y, dirX, dirY, maxDist }, mask);
+	}
+
+	RayHit GridMap::Raycast(const Ray& ray, GridIndex mask)
+	{
+		ChunkCursor cursor;
+		return CastRay(ray, mask, cursor);
+	}
+
+	void GridMap::Raycast(const Ray* rays, RayHit* hits, size_t count, GridIndex mask)
+	{
+		ChunkCursor cursor;
+		for (size_t i = 0; i < count; ++i)
+			hits[i] = CastRay(rays[i], mask, cursor);
+	}
+
+	bool GridMap::HasLineOfSight(float x0, float y0, float x1, float y1, GridIndex mask)
+	{
+		float dx = x1 - x0, dy = y1 - y0;
+		return !Raycast(x0, y0, dx, dy, std::sqrt(dx * dx + dy * dy), mask).hit;
+	}
+
+	RayHit GridMap::CastRay(const Ray& ray, GridIndex mask, ChunkCursor& cursor)
+	{
+		RayHit result;
+
+		float len = std::sqrt(ray.dirX * ray.dirX + ray.dirY * ray.dirY);
+		if (len == 0.0f || ray.maxDist < 0.0f || !m_gridCols || !m_gridRows)
+			return result;
+
+		const float ew = m_config.gridElementWidth;
+		const float eh = m_config.gridElementHeight;
+		const float dx = ray.dirX / len, dy = ray.dirY / len;
+		const float inf = std::numeric_limits<float>::infinity();
+
+		// Clip the ray against the grid so the walk never leaves it
+		float tEnter = 0.0f, tExit = ray.maxDist;
+		int enterNormalX = 0, enterNormalY = 0;
+		auto clip = [&](float o, float d, float hi, bool xAxis)
+		{
+			if (d == 0.0f)
+				return o >= 0.0f && o < hi;
+
+			float t0 = (0.0f - o) / d, t1 = (hi - o) / d;
+			if (t0 > t1)
+				std::swap(t0, t1);
+			if (t0 > tEnter)
+			{
+				tEnter = t0;
+				enterNormalX = xAxis ? -number_sign(d) : 0;
+				enterNormalY = xAxis ? 0 : -number_sign(d);
+			}
+			tExit = std::min(tExit, t1);
+			return tEnter <= tExit;
+		};
+		if (!clip(ray.x, dx, m_gridCols * ew, true) || !clip(ray.y, dy, m_gridRows * eh, false))
+			return result;
+
+		int col = std::clamp((int)std::floor((ray.x + dx * tEnter) / ew), 0, m_gridCols - 1);
+		int row = std::clamp((int)std::floor((ray.y + dy * tEnter) / eh), 0, m_gridRows - 1);
+		const int stepX = number_sign(dx), stepY = number_sign(dy);
+
+		// Distance along the ray to the next vertical / horizontal cell boundary
+		float tMaxX = stepX > 0 ? ((col + 1) * ew - ray.x) / dx : stepX < 0 ? (col * ew - ray.x) / dx : inf;
+		float tMaxY = stepY > 0 ? ((row + 1) * eh - ray.y) / dy : stepY < 0 ? (row * eh - ray.y) / dy : inf;
+		const float tDeltaX = stepX ? ew / std::fabs(dx) : inf;
+		const float tDeltaY = stepY ? eh / std::fabs(dy) : inf;
+
+		float t = tEnter;
+		int normalX = enterNormalX, normalY = enterNormalY;
+		for (;;)
+		{
+			size_t chunk = (size_t)(row >> GRID_CHUNK_SHIFT) * m_chunkCols + (col >> GRID_CHUNK_SHIFT);
+			if (chunk != cursor.chunk)
+			{
+				if (!m_chunks[chunk])
+					DecodeChunk(chunk);
+				cursor.chunk = chunk;
+				cursor.data = m_chunks[chunk].get();
+			}
+
+			if (cursor.data->cells[((row & GRID_CHUNK_MASK) << GRID_CHUNK_SHIFT) | (col & GRID_CHUNK_MASK)] & mask)
+			{
+				result = { true, t, ray.x + dx * t, ray.y + dy * t, col, row, normalX, normalY };
+				return result;
+			}
+
+			if (tMaxX < tMaxY)
+			{
+				t = tMaxX;
+				col += stepX;
+				tMaxX += tDeltaX;
+				normalX = -stepX;
+				normalY = 0;
+			}
+			else
+			{
+				t = tMaxY;
+				row += stepY;
+				tMaxY += tDeltaY;
+				normalX = 0;
+				normalY = -stepY;
+			}
+
+			if (t > tExit || col < 0 || col >= m_gridCols || row < 0 || row >= m_gridRows)
+				return result;
+		}
+	}
+
 	bool GridMap::IsOnSolidGround(Rect& r)
 	{
 		int dy = 1;
@@ -71,27 +416,23 @@ namespace scene
 
 		int maxSnapUp = 0;
 
-		// Check the rows at the sprite's bottom for solid tiles
-		// Look at the bottom few rows within step-up threshold
+		// Look at the bottom few rows within step-up threshold, the topmost
+		// solid row of each column gives the largest snap
 		auto maxRowsToCheck = m_config.SlopMaxElevetionPx / m_config.gridElementHeight;
 		auto topRowToCheck = bottomRow > maxRowsToCheck ? bottomRow - maxRowsToCheck : 0;
 
-		for (auto row = topRowToCheck; row <= bottomRow; ++row)
+		for (auto col = startCol; col <= endCol; ++col)
 		{
-			for (auto col = startCol; col <= endCol; ++col)
+			auto row = FirstSurfaceRow(col, topRowToCheck, bottomRow);
+			if (row < 0)
+				continue;
+
+			// Ground surface is at the top of this row
+			auto groundSurface = MulGridElementHeight(row);
+			auto snapUp = (spriteBottom + 1) - groundSurface;
+			if (snapUp > 0 && snapUp > maxSnapUp)
 			{
-				auto tileValue = GetGridTile(col, row);
-				if (tileValue & GRID_TOP_SOLID_MASK)
-				{
-					// Found solid ground - calculate snap distance
-					// Ground surface is at the top of this row
-					auto groundSurface = MulGridElementHeight(row);
-					auto snapUp = (spriteBottom + 1) - groundSurface;
-					if (snapUp > 0 && snapUp > maxSnapUp)
-					{
-						maxSnapUp = snapUp;
-					}
-				}
+				maxSnapUp = snapUp;
 			}
 		}
 
@@ -114,32 +455,31 @@ namespace scene
 		// Check if already on solid ground - no snap down needed
 		for (auto col = startCol; col <= endCol; ++col)
 		{
-			if (GetGridTile(col, bottomRow + 1) & GRID_TOP_SOLID_MASK)
+			if (FirstSurfaceRow(col, bottomRow + 1, bottomRow + 1) >= 0)
 			{
 				return 0; // Already on ground
 			}
 		}
 
-		// Search downward within step-down threshold for ground
+		// Search downward within step-down threshold for the nearest ground
 		auto maxRowsToCheck = m_config.SlopMaxElevetionPx / m_config.gridElementHeight;
 		auto gridMaxRows = m_config.totalRows * (m_config.tileHeight / m_config.gridElementHeight);
+		int lastRow = std::min<int>(bottomRow + 1 + maxRowsToCheck, gridMaxRows - 1);
 
-		for (Dim offset = 1; offset <= maxRowsToCheck; ++offset)
+		int groundRow = -1;
+		for (auto col = startCol; col <= endCol; ++col)
 		{
-			auto checkRow = bottomRow + 1 + offset;
-			if (checkRow >= gridMaxRows)
-				break;
+			auto row = FirstSurfaceRow(col, bottomRow + 2, lastRow);
+			if (row >= 0 && (groundRow < 0 || row < groundRow))
+				groundRow = row;
+		}
 
-			for (auto col = startCol; col <= endCol; ++col)
-			{
-				if (GetGridTile(col, checkRow) & GRID_TOP_SOLID_MASK)
-				{
-					// Found ground below - calculate snap distance
-					auto groundSurface = MulGridElementHeight(checkRow);
-					auto snapDown = groundSurface - (spriteBottom + 1);
-					return snapDown;
-				}
-			}
+		if (groundRow >= 0)
+		{
+			// Found ground below - calculate snap distance
+			auto groundSurface = MulGridElementHeight(groundRow);
+			auto snapDown = groundSurface - (spriteBottom + 1);
+			return snapDown;
 		}
 
 		return 0; // No ground found within threshold
@@ -156,49 +496,134 @@ namespace scene
 		auto leftX = centerX - sampleDistance;
 		auto rightX = centerX + sampleDistance;
 
-		// Find ground height at left sample point
-		int leftGroundY = -1;
-		auto leftCol = DivGridElementWidth(leftX);
+		// Search down from sprite bottom to find ground at both sample points
 		auto bottomRow = DivGridElementHeight(spriteBottom);
-
-		// Search down from sprite bottom to find ground
 		auto gridMaxRows = m_config.totalRows * (m_config.tileHeight / m_config.gridElementHeight);
-		for (Dim row = bottomRow; row < gridMaxRows && row <= bottomRow + 16; ++row)
+		int lastRow = std::min<int>(bottomRow + 16, gridMaxRows - 1);
+
+		int leftRow = FirstSurfaceRow(DivGridElementWidth(leftX), bottomRow, lastRow);
+		int rightRow = FirstSurfaceRow(DivGridElementWidth(rightX), bottomRow, lastRow);
+
+		// If we couldn't find ground at both points, return 0
+		if (leftRow < 0 || rightRow < 0)
+			return 0.0f;
+
+		return SlopeAngle(rightRow - leftRow, sampleDistance);
+	}
+
+	float GridMap::SlopeAngle(int rowDiff, int sampleDistance)
+	{
+		// Both ground rows lie within 16 rows below the sprite
+		constexpr int maxRowDiff = 16;
+		ASSERT(rowDiff >= -maxRowDiff && rowDiff <= maxRowDiff, "Failed. Slope sample rows out of range!");
+
+		// The table only depends on the sample distance, rebuilt if a caller uses another one
+		if (m_slopeLut.empty() || m_slopeLutSample != sampleDistance)
 		{
-			if (GetGridTile(leftCol, row) & GRID_TOP_SOLID_MASK)
+			m_slopeLut.resize(2 * maxRowDiff + 1);
+			for (int diff = -maxRowDiff; diff <= maxRowDiff; ++diff)
 			{
-				leftGroundY = MulGridElementHeight(row);
-				break;
+				// Negative heightDiff means ground goes UP to the right (uphill)
+				// Note: in screen coords, Y increases downward, so negate for proper angle
+				int heightDiff = diff * m_config.gridElementHeight;
+				int horizontalDist = sampleDistance * 2;
+
+				float angleRad = std::atan2(static_cast<float>(-heightDiff), static_cast<float>(horizontalDist));
+				m_slopeLut[diff + maxRowDiff] = angleRad * 180.0f / 3.14159265f;
 			}
+			m_slopeLutSample = sampleDistance;
 		}
 
-		// Find ground height at right sample point
-		int rightGroundY = -1;
-		auto rightCol = DivGridElementWidth(rightX);
-		for (Dim row = bottomRow; row < gridMaxRows && row <= bottomRow + 16; ++row)
+		return m_slopeLut[rowDiff + maxRowDiff];
+	}
+
+	void GridMap::InvalidateSurfaceIndex(void)
+	{
+		m_surfaces.assign(m_gridCols, {});
+		m_surfaceValid.assign(m_gridCols, false);
+	}
+
+	void GridMap::BuildSurfaceColumn(Dim col)
+	{
+		auto& runs = m_surfaces[col];
+		runs.clear();
+		m_surfaceValid[col] = true;
+
+		const GridChunk* empty = EmptyChunk().get();
+		const GridChunk* solid = SolidChunk().get();
+		bool open = false;
+
+		GridCell column[GRID_CHUNK_SIZE];
+		for (Dim chunkRow = 0; chunkRow < m_chunkRows; ++chunkRow)
 		{
-			if (GetGridTile(rightCol, row) & GRID_TOP_SOLID_MASK)
+			size_t index = (size_t)chunkRow * m_chunkCols + (col >> GRID_CHUNK_SHIFT);
+			Dim row0 = chunkRow * GRID_CHUNK_SIZE;
+			Dim rows = std::min<Dim>(GRID_CHUNK_SIZE, m_gridRows - row0);
+
+			// Only the one column is needed, an evicted or not yet touched chunk
+			// is read off the source and left for the streamer to install
+			const GridCell* cells;
+			size_t stride;
+			if (const GridChunk* chunk = m_chunks[index].get())
+			{
+				// Sentinels are uniform, no need to look at their cells
+				if (chunk == empty)
+				{
+					open = false;
+					continue;
+				}
+				if (chunk == solid)
+				{
+					if (!open)
+						runs.push_back({ row0, row0 });
+					runs.back().bottom = row0 + rows - 1;
+					open = true;
+					continue;
+				}
+
+				cells = chunk->cells + (col & GRID_CHUNK_MASK);
+				stride = GRID_CHUNK_SIZE;
+			}
+			else
 			{
-				rightGroundY = MulGridElementHeight(row);
-				break;
+				ReadSourceColumn(index, col & GRID_CHUNK_MASK, column);
+				cells = column;
+				stride = 1;
+			}
+
+			for (Dim y = 0; y < rows; ++y)
+			{
+				if (cells[y * stride] & GRID_TOP_SOLID_MASK)
+				{
+					if (!open)
+						runs.push_back({ (Dim)(row0 + y), (Dim)(row0 + y) });
+					runs.back().bottom = row0 + y;
+					open = true;
+				}
+				else
+					open = false;
 			}
 		}
+	}
 
-		// If we couldn't find ground at both points, return 0
-		if (leftGroundY < 0 || rightGroundY < 0)
-			return 0.0f;
+	int GridMap::FirstSurfaceRow(Dim col, int fromRow, int toRow)
+	{
+		if (col < 0 || col >= m_gridCols || fromRow > toRow)
+			return -1;	// Out of bounds = empty/passable
 
-		// Calculate slope: rise over run
-		// Negative heightDiff means ground goes UP to the right (uphill)
-		int heightDiff = rightGroundY - leftGroundY;
-		int horizontalDist = sampleDistance * 2;
+		if (!m_surfaceValid[col])
+			BuildSurfaceColumn(col);
 
-		// Convert to angle using atan2 (returns radians, convert to degrees)
-		// Note: in screen coords, Y increases downward, so negate for proper angle
-		float angleRad = std::atan2(static_cast<float>(-heightDiff), static_cast<float>(horizontalDist));
-		float angleDeg = angleRad * 180.0f / 3.14159265f;
+		// Runs are disjoint and sorted, so their bottoms are sorted too
+		auto& runs = m_surfaces[col];
+		auto run = std::lower_bound(
+			runs.begin(), runs.end(), fromRow,
+			[](const SurfaceRun& run, int row) { return run.bottom < row; }
+		);
 
-		return angleDeg;
+		if (run == runs.end() || run->top > toRow)
+			return -1;
+		return std::max<int>(run->top, fromRow);
 	}
 
 	int GridMap::GetWallPushOutDistance(Rect& r)
@@ -220,69 +645,188 @@ namespace scene
 		auto topRow = DivGridElementHeight(spriteTop);
 		auto bodyBottomRow = DivGridElementHeight(bodyCheckBottom);
 
-		// Bounds check
+		// Bounds check, everything outside the grid is empty
 		if (leftCol < 0) leftCol = 0;
-		if (rightCol < 0) return 0;
+		if (rightCol < 0 || leftCol >= m_gridCols) return 0;
 		if (topRow < 0) topRow = 0;
+		bodyBottomRow = std::min(bodyBottomRow, m_gridRows - 1);
 
-		// Check right edge for wall overlap in body area
-		for (Dim col = rightCol; col >= leftCol && col >= 0; --col)
+		// Rightmost solid column of the body, from the distances to the left of its right edge
+		auto edgeCol = std::min(rightCol, m_gridCols - 1);
+		auto hitCol = -1;
+		for (auto row = topRow; row <= bodyBottomRow; ++row)
 		{
-			for (Dim row = topRow; row <= bodyBottomRow; ++row)
+			auto distance = WallDistanceLeft(edgeCol, row);
+			if (distance < WALL_FIELD_MAX)
+				hitCol = std::max(hitCol, edgeCol - distance);
+		}
+
+		if (hitCol >= leftCol)
+		{
+			// Body overlaps solid - push left
+			auto pushDistance = spriteRight - MulGridElementWidth(hitCol) + 1;
+			if (pushDistance > 0 && pushDistance <= 8)  // Max 8 pixel push
 			{
-				if (GetGridTile(col, row) & GRID_SOLID_TILE)
-				{
-					// Body overlaps solid - push left
-					auto pushDistance = spriteRight - MulGridElementWidth(col) + 1;
-					if (pushDistance > 0 && pushDistance <= 8)  // Max 8 pixel push
-					{
-						return -pushDistance;
-					}
-				}
+				return -pushDistance;
 			}
 		}
 
-		// Check left edge for wall overlap in body area
-		for (Dim col = leftCol; col <= rightCol; ++col)
+		// Leftmost solid column of the body, from the distances to the right of its left edge
+		hitCol = INT_MAX;
+		for (auto row = topRow; row <= bodyBottomRow; ++row)
+		{
+			auto distance = WallDistanceRight(leftCol, row);
+			if (distance < WALL_FIELD_MAX)
+				hitCol = std::min(hitCol, leftCol + distance);
+		}
+
+		if (hitCol <= rightCol)
 		{
-			for (Dim row = topRow; row <= bodyBottomRow; ++row)
+			// Body overlaps solid - push right
+			auto pushDistance = MulGridElementWidth(hitCol + 1) - spriteLeft;
+			if (pushDistance > 0 && pushDistance <= 8)  // Max 8 pixel push
 			{
-				if (GetGridTile(col, row) & GRID_SOLID_TILE)
-				{
-					// Body overlaps solid - push right
-					auto pushDistance = MulGridElementWidth(col + 1) - spriteLeft;
-					if (pushDistance > 0 && pushDistance <= 8)  // Max 8 pixel push
-					{
-						return pushDistance;
-					}
-				}
+				return pushDistance;
 			}
 		}
 
 		return 0;
 	}
 
-	GridIndex* GridMap::Data(void)
+	void GridMap::InvalidateWallFields(void)
+	{
+		m_wallFields.clear();
+		m_wallFields.resize(m_chunks.size());
+	}
+
+	auto GridMap::WallFieldOf(size_t chunk) -> const WallField&
+	{
+		auto& field = m_wallFields[chunk];
+		if (!field)
+		{
+			field = std::make_unique<WallField>();
+
+			Dim row0 = (Dim)(chunk / m_chunkCols) << GRID_CHUNK_SHIFT;
+			for (Dim y = 0; y < (Dim)GRID_CHUNK_SIZE; ++y)
+				ComputeWallFieldRow(*field, chunk, row0 + y, 0, GRID_CHUNK_MASK);
+		}
+		return *field;
+	}
+
+	void GridMap::ComputeWallFieldRow(WallField& field, size_t chunk, Dim row, Dim col0, Dim col1)
+	{
+		// col0..col1 are chunk local, the scan reaches WALL_FIELD_MAX cells past
+		// both ends so every distance below the cap is exact
+		Dim base = (Dim)(chunk % m_chunkCols) << GRID_CHUNK_SHIFT;
+		Dim first = base + col0 - WALL_FIELD_MAX, last = base + col1 + WALL_FIELD_MAX;
+		byte* dest = field.cells + ((row & GRID_CHUNK_MASK) << GRID_CHUNK_SHIFT);
+
+		bool solid[GRID_CHUNK_SIZE + 2 * WALL_FIELD_MAX];
+		ASSERT(col1 - col0 < (Dim)GRID_CHUNK_SIZE, "Failed. Wall field row span is wider than a chunk!");
+		for (Dim col = first; col <= last; ++col)
+			solid[col - first] = row < m_gridRows && col >= 0 && col < m_gridCols && (Cell(col, row) & GRID_SOLID_TILE);
+
+		int distance = WALL_FIELD_MAX;
+		for (Dim col = first; col <= base + col1; ++col)
+		{
+			distance = solid[col - first] ? 0 : std::min(distance + 1, WALL_FIELD_MAX);
+			if (col >= base + col0)
+				dest[col - base] = (byte)distance;
+		}
+
+		distance = WALL_FIELD_MAX;
+		for (Dim col = last; col >= base + col0; --col)
+		{
+			distance = solid[col - first] ? 0 : std::min(distance + 1, WALL_FIELD_MAX);
+			if (col <= base + col1)
+				dest[col - base] = (byte)((dest[col - base] & 0x0F) | (distance << 4));
+		}
+	}
+
+	void GridMap::UpdateWallFields(Dim col, Dim row)
+	{
+		// Only cells within the cap of the edited one can see it, patch that part
+		// of the row in every chunk whose field is already built
+		Dim first = std::max<Dim>(col - WALL_FIELD_MAX, 0);
+		Dim last = std::min<Dim>(col + WALL_FIELD_MAX, m_gridCols - 1);
+		size_t rowSlot = (size_t)(row >> GRID_CHUNK_SHIFT) * m_chunkCols;
+
+		for (Dim chunkCol = first >> GRID_CHUNK_SHIFT; chunkCol <= last >> GRID_CHUNK_SHIFT; ++chunkCol)
+		{
+			auto& field = m_wallFields[rowSlot + chunkCol];
+			if (!field)
+				continue;
+
+			Dim base = chunkCol << GRID_CHUNK_SHIFT;
+			ComputeWallFieldRow(
+				*field,
+				rowSlot + chunkCol,
+				row,
+				std::max(first, base) - base,
+				std::min<Dim>(last, base + GRID_CHUNK_MASK) - base
+			);
+		}
+	}
+
+	int GridMap::WallDistanceLeft(Dim col, Dim row)
 	{
-		return static_cast<GridIndex*>(m_grid.data());
+		size_t chunk = (size_t)(row >> GRID_CHUNK_SHIFT) * m_chunkCols + (col >> GRID_CHUNK_SHIFT);
+		return WallFieldOf(chunk).cells[((row & GRID_CHUNK_MASK) << GRID_CHUNK_SHIFT) | (col & GRID_CHUNK_MASK)] & 0x0F;
+	}
+
+	int GridMap::WallDistanceRight(Dim col, Dim row)
+	{
+		size_t chunk = (size_t)(row >> GRID_CHUNK_SHIFT) * m_chunkCols + (col >> GRID_CHUNK_SHIFT);
+		return WallFieldOf(chunk).cells[((row & GRID_CHUNK_MASK) << GRID_CHUNK_SHIFT) | (col & GRID_CHUNK_MASK)] >> 4;
+	}
+
+	size_t GridMap::MemoryUsage(void) const
+	{
+		std::unordered_set<const GridChunk*> distinct;
+		for (auto& chunk : m_chunks)
+			if (chunk)
+				distinct.insert(chunk.get());
+
+		return distinct.size() * sizeof(GridChunk) + m_chunks.size() * sizeof(ChunkPtr);
 	}
 
 	void GridMap::SetGridTile(Dim col, Dim row, GridIndex index)
 	{
-		Dim totalCols = m_config.totalCols * GridBlockColumns();
-		m_grid[row * totalCols + col] = index;
+		ASSERT(index <= UINT8_MAX, "Failed. Grid flags do not fit in a grid cell!");
+		ASSERT(col >= 0 && col < m_gridCols && row >= 0 && row < m_gridRows, "Failed. Grid tile is out of bounds!");
+
+		size_t slot = (size_t)(row >> GRID_CHUNK_SHIFT) * m_chunkCols + (col >> GRID_CHUNK_SHIFT);
+		if (!m_chunks[slot])
+			DecodeChunk(slot);
+
+		auto& chunk = m_chunks[slot];
+		auto& cell = chunk->cells[((row & GRID_CHUNK_MASK) << GRID_CHUNK_SHIFT) | (col & GRID_CHUNK_MASK)];
+		if (cell == index)
+			return;
+
+		bool surfaceChanged = ((cell ^ index) & GRID_TOP_SOLID_MASK) != 0;
+		bool wallChanged = ((cell & GRID_SOLID_TILE) != 0) != ((index & GRID_SOLID_TILE) != 0);
+
+		// Copy on write, sentinels are always shared
+		if (chunk.use_count() > 1)
+			chunk = std::make_shared<GridChunk>(*chunk);
+
+		chunk->cells[((row & GRID_CHUNK_MASK) << GRID_CHUNK_SHIFT) | (col & GRID_CHUNK_MASK)] = static_cast<GridCell>(index);
+
+		m_chunkEdited[slot] = true;
+		if (surfaceChanged)
+			m_surfaceValid[col] = false;
+		if (wallChanged)
+			UpdateWallFields(col, row);
 	}
 
 	GridIndex GridMap::GetGridTile(Dim col, Dim row)
 	{
-		Dim totalCols = m_config.totalCols * GridBlockColumns();
-		Dim totalRows = m_config.totalRows * GridBlockRows();
-
 		// Bounds checking to prevent crashes
-		if (col < 0 || col >= totalCols || row < 0 || row >= totalRows)
+		if (col < 0 || col >= m_gridCols || row < 0 || row >= m_gridRows)
 			return GRID_EMPTY_TILE;  // Out of bounds = empty/passable
 
-		return m_grid[row * totalCols + col];
+		return Cell(col, row);
 	}
 
 	void GridMap::SetSolidGridTile(Dim col, Dim row)
@@ -310,16 +854,14 @@ namespace scene
 		return (GetGridTile(col, row) & flags) != 0;
 	}
 
-	GridIndex* GridMap::GetGridTileBlock(Dim colTile, Dim rowTile, Dim tileCols)
+	void GridMap::SetGridTileBlock(Dim colTile, Dim rowTile, GridIndex flags)
 	{
-		Dim pos = (rowTile * tileCols + colTile) * GridElementsPerTile();
-		return m_grid.data() + pos;
-	}
+		Dim col0 = colTile * GridBlockColumns();
+		Dim row0 = rowTile * GridBlockRows();
 
-	void GridMap::SetGridTileBlock(Dim colTile, Dim rowTile, Dim tileCols, GridIndex flags)
-	{
-		GridIndex* block = GetGridTileBlock(colTile, rowTile, tileCols);
-		std::fill_n(block, GridElementsPerTile(), flags);
+		for (Dim row = row0; row < row0 + GridBlockRows(); ++row)
+			for (Dim col = col0; col < col0 + GridBlockColumns(); ++col)
+				SetGridTile(col, row, flags);
 	}
 
 	void GridMap::FilterGridMotionDown(Rect& r, int* dy)
@@ -583,233 +1125,525 @@ namespace scene
 		}
 	}
 
-	void GridMap::ComputeTileGridBlock(TileLayer* tlayer, Dim row, Dim col, Dim tileCols, byte solidThreshold, bool assumtedEmpty)
-	{ 
-		// Bitmap tileElement = BitmapCreate(m_config.tileWidth, m_config.tileHeight);
-		// Bitmap gridElement = BitmapCreate(m_config.gridElementWidth, m_config.gridElementHeight);
+	bool GridMap::BakeFromTileset(const TileLayer& tlayer, const std::string& tilesetPath, byte solidThreshold)
+	{
+		if (m_chunks.empty())
+			return false; // Grid must be configured first
+
+		const TileConfig& tcfg = tlayer.Config();
+		if (tcfg.tileWidth % m_config.gridElementWidth || tcfg.tileHeight % m_config.gridElementHeight)
+			return false; // Tiles must split into whole grid elements
+
+		// Read the tileset once and keep only its alpha, the per element counts
+		// then walk a quarter of the bytes
+		AlphaImage tileset;
+		int channels = 0;
+		byte* pixels = stbi_load(tilesetPath.c_str(), &tileset.w, &tileset.h, &channels, STBI_rgb_alpha);
+		if (!pixels)
+			return false;
+
+		tileset.alpha.resize((size_t)tileset.w * tileset.h);
+		for (size_t i = 0; i < tileset.alpha.size(); ++i)
+			tileset.alpha[i] = pixels[i * 4 + 3];
+		stbi_image_free(pixels);
 
-		// auto index = tlayer->GetTile(col, row);
-		// if (assumtedEmpty)
-		// 	SetGridTileBlock(col, row, tileCols, GRID_EMPTY_TILE);
-		// else
-		// {
-		// 	tlayer->PutTile(tileElement, 0, 0, tlayer->m_tileset, index);
-		// 	ComputeGridBlock(
-		// 		GetGridTileBlock(col, row, tileCols),
-		// 		tileElement,
-		// 		gridElement,
-		// 		tlayer->m_tileset,
-		// 		solidThreshold
-		// 	);
-		// }
+		ResetChunks();
 
-		// BitmapDestroy(tileElement);
-		// BitmapDestroy(gridElement);
+		// Workers bake whole chunk rows, one band of grid rows at a time, and
+		// hand each band to the interner as soon as it is done
+		ChunkInterner interner;
+		std::mutex internerLock;
+		// The tile layer has its own tile size, not necessarily the grid's
+		const Dim gridRowsPerTile = tcfg.tileHeight / m_config.gridElementHeight;
+		auto bakeBands = [&](Dim first, Dim last)
+		{
+			std::vector<GridCell> band((size_t)GRID_CHUNK_SIZE * m_gridCols);
+			for (Dim chunkRow = first; chunkRow < last; ++chunkRow)
+			{
+				std::fill(band.begin(), band.end(), (GridCell)GRID_EMPTY_TILE);
+
+				Dim bandRow0 = chunkRow * GRID_CHUNK_SIZE;
+				Dim lastTileRow = std::min<Dim>((bandRow0 + GRID_CHUNK_SIZE - 1) / gridRowsPerTile, tcfg.totalRows - 1);
+				for (Dim row = bandRow0 / gridRowsPerTile; row <= lastTileRow; ++row)
+					for (Dim col = 0; col < tcfg.totalCols; ++col)
+						ComputeTileGridBlock(tlayer, col, row, tileset, band.data(), bandRow0, solidThreshold);
+
+				std::lock_guard<std::mutex> lock(internerLock);
+				StoreChunkRow(chunkRow, band.data(), interner);
+			}
+		};
+
+		Dim workers = (Dim)std::clamp<unsigned>(std::thread::hardware_concurrency(), 1u, std::max<unsigned>(m_chunkRows, 1u));
+		Dim perWorker = (m_chunkRows + workers - 1) / workers;
+		std::vector<std::thread> threads;
+		for (Dim w = 1; w < workers && w * perWorker < m_chunkRows; ++w)
+			threads.emplace_back(bakeBands, (Dim)(w * perWorker), (Dim)std::min<int>((w + 1) * perWorker, m_chunkRows));
+		bakeBands(0, std::min<Dim>(perWorker, m_chunkRows));
+
+		for (auto& t : threads)
+			t.join();
+
+		return true;
 	}
 
-	bool GridMap::LoadFromCSV(const std::string& csvContent)
+	void GridMap::ComputeTileGridBlock(const TileLayer& tlayer, Dim col, Dim row, const AlphaImage& tileset, GridCell* band, Dim bandRow0, byte solidThreshold)
 	{
-		if (m_grid.empty())
-			return false; // Grid must be configured first
+		const TileConfig& tcfg = tlayer.Config();
+
+		// Block of grid elements covered by the tile, clipped to the grid and
+		// to the band of GRID_CHUNK_SIZE rows starting at bandRow0
+		int col0 = col * tcfg.tileWidth / m_config.gridElementWidth;
+		int row0 = row * tcfg.tileHeight / m_config.gridElementHeight;
+		int blockCols = std::min<int>(tcfg.tileWidth / m_config.gridElementWidth, m_gridCols - col0);
+		int y0 = std::max<int>(row0, bandRow0);
+		int y1 = std::min<int>({ row0 + tcfg.tileHeight / m_config.gridElementHeight, bandRow0 + (int)GRID_CHUNK_SIZE, m_gridRows });
+		if (blockCols <= 0 || y1 <= y0)
+			return;
+
+		Index index = tlayer.GetTile(col, row);
+		if (TileLayer::TileX(index) == UINT16_MAX && TileLayer::TileY(index) == UINT16_MAX)
+			return;	// no tile, the band is already empty
+
+		ComputeGridBlock(
+			band + (size_t)(y0 - bandRow0) * m_gridCols + col0,
+			tileset,
+			TileLayer::TileX(index),
+			TileLayer::TileY(index) + (y0 - row0) * m_config.gridElementHeight,
+			(Dim)blockCols,
+			(Dim)(y1 - y0),
+			solidThreshold
+		);
+	}
 
-		std::istringstream stream(csvContent);
-		std::string line;
-		Dim row = 0;
-		Dim totalCols = m_config.totalCols * GridBlockColumns();
-		Dim totalRows = m_config.totalRows * GridBlockRows();
+	bool GridMap::LoadFromCSV(std::string_view csvContent)
+	{
+		if (m_chunks.empty())
+			return false; // Grid must be configured first
 
-		while (std::getline(stream, line) && row < totalRows)
-		{
-			if (line.empty())
-				continue;
+		ResetChunks();
 
-			std::istringstream lineStream(line);
-			std::string cell;
-			Dim col = 0;
+		const Dim totalCols = m_gridCols;
+		const Dim totalRows = m_gridRows;
 
-			while (std::getline(lineStream, cell, ',') && col < totalCols)
+		// Each chunk row is parsed whole by one worker into a band of its own,
+		// which is interned and freed once its last row is in. Only the bands
+		// in flight are ever staged, never the whole grid.
+		ChunkInterner interner;
+		std::mutex internerLock;
+		std::vector<std::vector<GridCell>> bands(m_chunkRows);
+		bool parsed = io::ParseIntCSV(csvContent, totalRows, totalCols,
+			[&](size_t row, const int* values)
 			{
-				int value = std::stoi(cell);
-				GridIndex gridValue;
-
-				// Map CSV values to grid flags
-				if (value == -1)
-					gridValue = GRID_EMPTY_TILE;
-				else if (value == 0)
-					gridValue = GRID_SOLID_TILE;
-				else
-					gridValue = static_cast<GridIndex>(value);
+				Dim chunkRow = (Dim)(row >> GRID_CHUNK_SHIFT);
+				auto& band = bands[chunkRow];
+				if ((row & GRID_CHUNK_MASK) == 0)
+					band.assign((size_t)GRID_CHUNK_SIZE * totalCols, GRID_EMPTY_TILE);
 
-				m_grid[row * totalCols + col] = gridValue;
-				++col;
-			}
+				GridCell* dest = band.data() + (row & GRID_CHUNK_MASK) * totalCols;
+				for (Dim col = 0; col < totalCols; ++col)
+				{
+					// Map CSV values to grid flags
+					int value = values[col];
+					if (value == -1)
+						dest[col] = GRID_EMPTY_TILE;
+					else if (value == 0)
+						dest[col] = GRID_SOLID_TILE;
+					else
+						dest[col] = static_cast<GridCell>(value);
+				}
 
-			if (col != totalCols)
-				return false; // Column count mismatch
+				if ((row & GRID_CHUNK_MASK) == GRID_CHUNK_MASK || row + 1 == (size_t)totalRows)
+				{
+					{
+						std::lock_guard<std::mutex> lock(internerLock);
+						StoreChunkRow(chunkRow, band.data(), interner);
+					}
+					std::vector<GridCell>().swap(band);
+				}
+			},
+			GRID_CHUNK_SIZE);
 
-			++row;
+		if (!parsed)
+		{
+			ResetChunks();	// drop the bands stored before the failure
+			return false; // Row or column count mismatch
 		}
 
-		if (row != totalRows)
-			return false; // Row count mismatch
-
 		return true;
 	}
 
+	bool GridMap::LoadFromCSVFile(const std::string& filePath)
+	{
+		io::MappedFile file;
+		if (!file.Open(filePath))
+			return false;
+
+		return LoadFromCSV(std::string_view(reinterpret_cast<const char*>(file.Data()), file.Size()));
+	}
+
 	bool GridMap::LoadFromRLE(const std::string& filePath)
 	{
-		if (m_grid.empty())
+		if (m_chunks.empty())
 			return false; // Grid must be configured first
 
-		std::ifstream file(filePath, std::ios::binary);
-		if (!file)
+		auto file = std::make_unique<io::MappedFile>();
+		if (!file->Open(filePath))
 			return false;
 
-		// Read and verify header
-		char magic[4];
-		file.read(magic, 4);
-		if (magic[0] != 'G' || magic[1] != 'R' || magic[2] != 'L' || magic[3] != 'E')
+		// Verify header
+		const byte* data = file->Data();
+		if (file->Size() < GRLE_V1_HEADER_SIZE || memcmp(data, "GRLE", 4) != 0)
 			return false; // Invalid magic
 
-		uint32_t version, cols, rows;
-		file.read(reinterpret_cast<char*>(&version), sizeof(version));
-		file.read(reinterpret_cast<char*>(&cols), sizeof(cols));
-		file.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+		uint32_t version = ReadU32(data + 4);
+		uint32_t cols = ReadU32(data + 8);
+		uint32_t rows = ReadU32(data + 12);
 
-		if (version != 1)
-			return false; // Unsupported version
+		if (cols != (uint32_t)m_gridCols || rows != (uint32_t)m_gridRows)
+			return false; // Size mismatch
 
-		Dim totalCols = m_config.totalCols * GridBlockColumns();
-		Dim totalRows = m_config.totalRows * GridBlockRows();
+		if (version == 1)
+			return LoadRLEv1(*file);
+		if (version == 2)
+			return LoadRLEv2(std::move(file));
 
-		if (cols != totalCols || rows != totalRows)
-			return false; // Size mismatch
+		return false; // Unsupported version
+	}
 
-		// Read RLE data
-		size_t index = 0;
-		size_t totalCells = static_cast<size_t>(totalCols) * totalRows;
+	bool GridMap::LoadRLEv1(const io::MappedFile& file)
+	{
+		ResetChunks();
 
-		while (index < totalCells && file)
-		{
-			uint8_t value;
-			uint32_t count;
+		// One { uint8 value, uint32 count } run after another over the whole grid
+		const byte* run = file.Data() + GRLE_V1_HEADER_SIZE;
+		const byte* end = file.Data() + file.Size();
 
-			file.read(reinterpret_cast<char*>(&value), sizeof(value));
-			file.read(reinterpret_cast<char*>(&count), sizeof(count));
+		// Runs are staged one chunk row at a time
+		size_t index = 0;
+		size_t totalCells = static_cast<size_t>(m_gridCols) * m_gridRows;
+		size_t stagingCells = (size_t)GRID_CHUNK_SIZE * m_gridCols;
 
-			if (!file)
-				break;
+		ChunkInterner interner;
+		std::vector<GridCell> staging(stagingCells, GRID_EMPTY_TILE);
+
+		for (; index < totalCells && end - run >= 5; run += 5)
+		{
+			uint8_t value = run[0];
+			uint32_t count = ReadU32(run + 1);
 
 			// Fill the grid with this run
-			GridIndex gridValue = static_cast<GridIndex>(value);
 			size_t endIndex = std::min(index + count, totalCells);
-
-			for (size_t i = index; i < endIndex; ++i)
-				m_grid[i] = gridValue;
-
-			index = endIndex;
+			while (index < endIndex)
+			{
+				size_t chunkRowEnd = (index / stagingCells + 1) * stagingCells;
+				size_t runEnd = std::min(endIndex, chunkRowEnd);
+				std::fill(
+					staging.begin() + (index % stagingCells),
+					staging.begin() + (index % stagingCells) + (runEnd - index),
+					static_cast<GridCell>(value)
+				);
+
+				index = runEnd;
+				if (index == chunkRowEnd || index == totalCells)
+					StoreChunkRow((Dim)((index - 1) / stagingCells), staging.data(), interner);
+			}
 		}
 
 		return index == totalCells;
 	}
 
-	bool GridMap::SaveToRLE(const std::string& filePath) const
+	bool GridMap::LoadRLEv2(std::unique_ptr<io::MappedFile> file)
 	{
-		if (m_grid.empty())
+		const byte* data = file->Data();
+		size_t size = file->Size();
+
+		if (size < GRLE_V2_HEADER_SIZE)
 			return false;
 
-		std::ofstream file(filePath, std::ios::binary);
-		if (!file)
+		if (ReadU32(data + 16) != GRID_CHUNK_SIZE || ReadU32(data + 20) != (uint32_t)m_chunkCols || ReadU32(data + 24) != (uint32_t)m_chunkRows)
+			return false; // Different chunking
+
+		size_t totalChunks = (size_t)m_chunkCols * m_chunkRows;
+		size_t dataStart = GRLE_V2_HEADER_SIZE + totalChunks * sizeof(RleChunkEntry);
+		if (size < dataStart)
 			return false;
 
-		// Write header
-		file.write("GRLE", 4); // Magic
+		// Validate the directory and every run list before the grid is touched,
+		// chunks decode later and must not fail then
+		auto dir = reinterpret_cast<const RleChunkEntry*>(data + GRLE_V2_HEADER_SIZE);
+		std::unordered_map<uint32_t, uint16_t> checked;	// offset -> runs
+		for (size_t i = 0; i < totalChunks; ++i)
+		{
+			if (!dir[i].runs)
+				continue;
+			if (dir[i].offset < dataStart || dir[i].offset + dir[i].runs * GRLE_V2_RUN_SIZE > size)
+				return false;
 
-		uint32_t version = 1;
-		uint32_t cols = m_config.totalCols * (m_config.tileWidth / m_config.gridElementWidth);
-		uint32_t rows = m_config.totalRows * (m_config.tileHeight / m_config.gridElementHeight);
+			// Shared data must be shared whole, decoded chunks are cached by offset
+			auto [seen, inserted] = checked.emplace(dir[i].offset, dir[i].runs);
+			if (!inserted)
+			{
+				if (seen->second != dir[i].runs)
+					return false;
+				continue;	// shared with a chunk already checked
+			}
 
-		file.write(reinterpret_cast<const char*>(&version), sizeof(version));
-		file.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
-		file.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+			size_t cells = 0;
+			const byte* run = data + dir[i].offset;
+			for (uint16_t r = 0; r < dir[i].runs; ++r, run += GRLE_V2_RUN_SIZE)
+				cells += run[1] | (run[2] << 8);
+			if (cells != GRID_CHUNK_CELLS)
+				return false;
+		}
 
-		// Write RLE data
-		if (m_grid.empty())
-			return true;
+		ResetChunks();
 
-		uint8_t currentValue = static_cast<uint8_t>(m_grid[0]);
-		uint32_t count = 1;
+		std::unordered_map<GridCell, ChunkPtr> uniform{
+			{ (GridCell)GRID_EMPTY_TILE, EmptyChunk() },
+			{ (GridCell)GRID_SOLID_TILE, SolidChunk() }
+		};
 
-		for (size_t i = 1; i < m_grid.size(); ++i)
+		for (size_t i = 0; i < totalChunks; ++i)
 		{
-			uint8_t value = static_cast<uint8_t>(m_grid[i]);
-
-			if (value == currentValue && count < UINT32_MAX)
+			if (dir[i].runs)
 			{
-				++count;
+				m_chunks[i] = nullptr;
+				++m_sourcePending;
+				continue;
 			}
-			else
-			{
-				// Write the run
-				file.write(reinterpret_cast<const char*>(&currentValue), sizeof(currentValue));
-				file.write(reinterpret_cast<const char*>(&count), sizeof(count));
 
-				currentValue = value;
-				count = 1;
+			auto& chunk = uniform[dir[i].fill];
+			if (!chunk)
+			{
+				chunk = std::make_shared<GridChunk>();
+				std::fill(std::begin(chunk->cells), std::end(chunk->cells), dir[i].fill);
 			}
+			m_chunks[i] = chunk;
 		}
 
-		// Write final run
-		file.write(reinterpret_cast<const char*>(&currentValue), sizeof(currentValue));
-		file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+		// Keep the mapping only while some chunk still lives in it
+		if (m_sourcePending)
+		{
+			m_source = std::move(file);
+			m_sourceDir = dir;
+		}
+		return true;
+	}
 
-		return file.good();
+	void GridMap::DecodeChunk(size_t chunk) const
+	{
+		ASSERT(m_source && !m_chunks[chunk], "Failed. Grid chunk has no pending data!");
+
+		auto& shared = m_sourceDecoded[m_sourceDir[chunk].offset];
+		ChunkPtr decoded = shared.lock();
+		if (!decoded)
+		{
+			decoded = DecodeSourceChunk(chunk);
+			shared = decoded;
+		}
+
+		m_chunks[chunk] = decoded;
+		if (--m_sourcePending == 0 && !m_sourceKept)
+			ReleaseSource();
+	}
+
+	auto GridMap::DecodeSourceChunk(size_t chunk) const -> ChunkPtr
+	{
+		auto& entry = m_sourceDir[chunk];
+		auto decoded = std::make_shared<GridChunk>();
+
+		const byte* run = m_source->Data() + entry.offset;
+		size_t cell = 0;
+		for (uint16_t i = 0; i < entry.runs; ++i, run += GRLE_V2_RUN_SIZE)
+		{
+			size_t count = std::min<size_t>(run[1] | (run[2] << 8), GRID_CHUNK_CELLS - cell);
+			std::fill_n(decoded->cells + cell, count, run[0]);
+			cell += count;
+		}
+		ASSERT(cell == GRID_CHUNK_CELLS, "Failed. Corrupted GRLE chunk!");
+
+		return decoded;
+	}
+
+	void GridMap::ReadSourceColumn(size_t chunk, Dim x, GridCell* column) const
+	{
+		ASSERT(m_source && IsSourceChunk(chunk), "Failed. Grid chunk has no pending data!");
+
+		// Cell x of every chunk row, picked out of the runs as they go by
+		auto& entry = m_sourceDir[chunk];
+		const byte* run = m_source->Data() + entry.offset;
+		size_t runEnd = 0, next = (size_t)x;
+		Dim y = 0;
+		for (uint16_t i = 0; i < entry.runs && y < (Dim)GRID_CHUNK_SIZE; ++i, run += GRLE_V2_RUN_SIZE)
+		{
+			runEnd += run[1] | (run[2] << 8);
+			for (; next < runEnd && y < (Dim)GRID_CHUNK_SIZE; next += GRID_CHUNK_SIZE)
+				column[y++] = run[0];
+		}
+		ASSERT(y == (Dim)GRID_CHUNK_SIZE, "Failed. Corrupted GRLE chunk!");
+	}
+
+	void GridMap::InstallChunk(size_t chunk, ChunkPtr decoded)
+	{
+		if (m_chunks[chunk])
+			return;	// decoded on demand in the meantime
+
+		// Prefer a live copy shared with another slot over the new one
+		auto& shared = m_sourceDecoded[m_sourceDir[chunk].offset];
+		if (auto live = shared.lock())
+			decoded = std::move(live);
+		else
+			shared = decoded;
+
+		m_chunks[chunk] = std::move(decoded);
+		--m_sourcePending;
+	}
+
+	bool GridMap::IsSourceChunk(size_t chunk) const
+	{
+		return m_source && m_sourceDir[chunk].runs;
+	}
+
+	bool GridMap::CanEvictChunk(size_t chunk) const
+	{
+		return m_chunks[chunk] && IsSourceChunk(chunk) && !m_chunkEdited[chunk];
+	}
+
+	void GridMap::EvictChunk(size_t chunk)
+	{
+		ASSERT(CanEvictChunk(chunk), "Failed. Grid chunk can not be decoded again!");
+
+		m_chunks[chunk] = nullptr;
+		m_wallFields[chunk].reset();
+		++m_sourcePending;
 	}
 
-	bool GridMap::ComputeIsGridIndexEmpty(Bitmap& gridElem, byte solidThreshold)
+	void GridMap::KeepSource(bool keep)
 	{
-		// auto n = 0;
-		// BitmapAccessPixels(
-		// 	gridElem,
-		// 	[&n](PixelMemory mem)
-		// 	{
-		// 		RGBA memValue;
-		// 		ReadPixelColor(mem, &memValue);
+		m_sourceKept = keep;
+		if (!keep && m_source && !m_sourcePending)
+			ReleaseSource();
+	}
+
+	void GridMap::DecodeAllChunks(void) const
+	{
+		for (size_t i = 0; i < m_chunks.size() && m_source; ++i)
+			if (!m_chunks[i])
+				DecodeChunk(i);
+	}
+
+	void GridMap::ReleaseSource(void) const
+	{
+		m_source.reset();
+		m_sourceDir = nullptr;
+		m_sourceDecoded.clear();
+		m_sourcePending = 0;
+	}
+
+	bool GridMap::SaveToRLE(const std::string& filePath) const
+	{
+		if (m_chunks.empty())
+			return false;
 
-		// 		if (memValue.a != 0)
-		// 			++n;
+		// The mapped source may be the very file being overwritten
+		ASSERT(!m_sourceKept, "Failed. Stop the level streamer before saving the grid!");
+		DecodeAllChunks();
 
-		// 		return true;
-		// 	}
-		// );
+		std::ofstream file(filePath, std::ios::binary);
+		if (!file)
+			return false;
+
+		// Encode chunks, each distinct chunk is written once
+		uint32_t dataStart = (uint32_t)(GRLE_V2_HEADER_SIZE + m_chunks.size() * sizeof(RleChunkEntry));
+		std::vector<RleChunkEntry> dir(m_chunks.size());
+		std::vector<byte> blob;
+		std::unordered_map<const GridChunk*, RleChunkEntry> written;
+
+		for (size_t i = 0; i < m_chunks.size(); ++i)
+		{
+			const GridChunk* chunk = m_chunks[i].get();
+			auto found = written.find(chunk);
+			if (found != written.end())
+			{
+				dir[i] = found->second;
+				continue;
+			}
+
+			RleChunkEntry entry{ dataStart + (uint32_t)blob.size(), 0, chunk->cells[0], 0 };
+			for (size_t cell = 0; cell < GRID_CHUNK_CELLS;)
+			{
+				GridCell value = chunk->cells[cell];
+				size_t count = 1;
+				while (cell + count < GRID_CHUNK_CELLS && chunk->cells[cell + count] == value)
+					++count;
+
+				blob.push_back(value);
+				blob.push_back((byte)(count & 0xFF));
+				blob.push_back((byte)(count >> 8));
+				++entry.runs;
+				cell += count;
+			}
 
-		// return n <= solidThreshold;
+			// Uniform chunk, nothing to store
+			if (entry.runs == 1)
+			{
+				blob.resize(blob.size() - GRLE_V2_RUN_SIZE);
+				entry = { 0, 0, chunk->cells[0], 0 };
+			}
+
+			written[chunk] = dir[i] = entry;
+		}
+
+		// Write header
+		uint32_t header[] = {
+			2,							// version
+			(uint32_t)m_gridCols, (uint32_t)m_gridRows,
+			GRID_CHUNK_SIZE,
+			(uint32_t)m_chunkCols, (uint32_t)m_chunkRows,
+			0							// reserved
+		};
+
+		file.write("GRLE", 4); // Magic
+		file.write(reinterpret_cast<const char*>(header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(dir.data()), dir.size() * sizeof(RleChunkEntry));
+		file.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+
+		return file.good();
 	}
 
-	void GridMap::ComputeGridBlock(GridIndex* block, Bitmap& tileElem, Bitmap& gridElem, Bitmap& tileSet, byte solidThreshold)
+	bool GridMap::ComputeIsGridIndexEmpty(const AlphaImage& tileset, int x, int y, byte solidThreshold)
 	{
-		// for (auto i = 0; i < GridElementsPerTile(); ++i)
-		// {
-		// 	auto x = i % GridBlockColumns();
-		// 	auto y = i / GridBlockRows();
+		// Pixels outside the tileset image count as transparent
+		int x1 = std::max(x, 0), x2 = std::min(x + m_config.gridElementWidth, tileset.w);
+		int y1 = std::max(y, 0), y2 = std::min(y + m_config.gridElementHeight, tileset.h);
 
-		// 	Rect tl = { 
-		// 		x * m_config.gridElementWidth, 
-		// 		y * m_config.gridElementHeight, 
-		// 		m_config.gridElementWidth, 
-		// 		m_config.gridElementHeight 
-		// 	};
+		int n = 0;
+		for (int py = y1; py < y2; ++py)
+		{
+			const byte* alpha = tileset.alpha.data() + (size_t)py * tileset.w;
+			for (int px = x1; px < x2; ++px)
+				n += alpha[px] != 0;
+		}
 
-		// 	BitmapBlit(
-		// 		tileElem,
-		// 		tl,
-		// 		gridElem,
-		// 		{ 0, 0 }
-		// 	);
+		return n <= solidThreshold;
+	}
 
-		// 	auto isEmpty = ComputeIsGridIndexEmpty(gridElem, solidThreshold);
-		// 	*block++ = isEmpty ? GRID_EMPTY_TILE : GRID_SOLID_TILE;
-		// }
+	void GridMap::ComputeGridBlock(GridCell* block, const AlphaImage& tileset, int tileX, int tileY, Dim blockCols, Dim blockRows, byte solidThreshold)
+	{
+		for (Dim y = 0; y < blockRows; ++y)
+		{
+			GridCell* dest = block + (size_t)y * m_gridCols;
+			for (Dim x = 0; x < blockCols; ++x)
+			{
+				auto isEmpty = ComputeIsGridIndexEmpty(
+					tileset,
+					tileX + x * m_config.gridElementWidth,
+					tileY + y * m_config.gridElementHeight,
+					solidThreshold
+				);
+				dest[x] = isEmpty ? GRID_EMPTY_TILE : GRID_SOLID_TILE;
+			}
+		}
 	}
 
 	inline Dim GridMap::GridBlockColumns()
@@ -827,14 +1661,15 @@ namespace scene
 		return GridBlockColumns() * GridBlockRows();
 	}
 
+	// Floor division, so pixels left of or above the grid map to negative elements
 	inline Dim GridMap::DivGridElementWidth(Dim i)
 	{
-		return i / m_config.gridElementWidth;
+		return FloorDiv(i, m_config.gridElementWidth);
 	}
 
 	inline Dim GridMap::DivGridElementHeight(Dim i)
 	{
-		return i / m_config.gridElementHeight;
+		return FloorDiv(i, m_config.gridElementHeight);
 	}
 
 	inline Dim GridMap::MulGridElementWidth(Dim i)
@@ -852,6 +1687,15 @@ namespace scene
 		return GridElementsPerTile() * sizeof(GridIndex);
 	}
 
+	inline GridCell GridMap::Cell(Dim col, Dim row) const
+	{
+		size_t chunk = (size_t)(row >> GRID_CHUNK_SHIFT) * m_chunkCols + (col >> GRID_CHUNK_SHIFT);
+		if (!m_chunks[chunk])
+			DecodeChunk(chunk);
+
+		return m_chunks[chunk]->cells[((row & GRID_CHUNK_MASK) << GRID_CHUNK_SHIFT) | (col & GRID_CHUNK_MASK)];
+	}
+
 	inline bool GridMap::Valid() const
 	{
 		return (m_config.tileHeight % m_config.gridElementHeight) == 0 && (m_config.tileWidth % m_config.gridElementWidth) == 0;
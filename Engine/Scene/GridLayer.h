@@ -3,12 +3,23 @@
 #include "Utils/Common.h"
 #include "Rendering/Bitmap.h"
 
+#include <string>
+#include <string_view>
 #include <vector>
+#include <memory>
+#include <unordered_map>
+
+namespace io
+{
+	class MappedFile;
+}
 
 namespace scene
 {
 	using namespace gfx;
 
+	class TileLayer;
+
 	inline constexpr unsigned short GRID_THIN_AIR_MASK = 0x00; // element is ignored
 	inline constexpr unsigned short GRID_LEFT_SOLID_MASK = 0x01; // bit 0
 	inline constexpr unsigned short GRID_RIGHT_SOLID_MASK = 0x02; // bit 1
@@ -20,6 +31,54 @@ namespace scene
 	inline constexpr unsigned short GRID_SOLID_TILE =
 		(GRID_LEFT_SOLID_MASK | GRID_RIGHT_SOLID_MASK | GRID_TOP_SOLID_MASK | GRID_BOTTOM_SOLID_MASK);
 
+	// Storage type of a grid element. Only the GRID_* flags are ever stored,
+	// so cells are packed in 8 bits while the API keeps talking GridIndex.
+	typedef uint8_t GridCell;
+	static_assert(
+		(GRID_SOLID_TILE | GRID_GROUND_MASK | GRID_FLOATING_MASK) <= UINT8_MAX,
+		"Grid flags no longer fit in a GridCell!"
+	);
+
+	// The grid is stored in square chunks of cells. Uniform chunks share one
+	// sentinel, identical dense chunks are shared and copied on write.
+	inline constexpr unsigned GRID_CHUNK_SHIFT = 6;
+	inline constexpr unsigned GRID_CHUNK_SIZE = 1u << GRID_CHUNK_SHIFT;	// 64x64 cells
+	inline constexpr unsigned GRID_CHUNK_MASK = GRID_CHUNK_SIZE - 1;
+
+	struct GridChunk
+	{
+		GridCell cells[GRID_CHUNK_SIZE * GRID_CHUNK_SIZE];
+	};
+
+	// Result of GridMap::SweepAABB
+	struct SweepHit
+	{
+		bool  hit = false;
+		float time = 1.0f;			// fraction of the displacement travelled before contact
+		int   normalX = 0;			// contact normal, points away from the blocking cells
+		int   normalY = 0;
+		int   dx = 0, dy = 0;		// displacement that stops just short of the contact
+	};
+
+	// Ray in pixel space, pixel (x, y) covers [x, x + 1) x [y, y + 1)
+	struct Ray
+	{
+		float x = 0.0f, y = 0.0f;			// origin
+		float dirX = 0.0f, dirY = 0.0f;		// need not be normalized
+		float maxDist = 0.0f;				// in pixels along the direction
+	};
+
+	// Result of GridMap::Raycast
+	struct RayHit
+	{
+		bool  hit = false;
+		float distance = 0.0f;		// pixels from the origin to the contact, 0 if it starts in a blocked cell
+		float x = 0.0f, y = 0.0f;	// contact point
+		int   col = -1, row = -1;	// blocking grid cell
+		int   normalX = 0;			// face of the cell that was crossed, 0 when starting inside it
+		int   normalY = 0;
+	};
+
 	struct GridConfig
 	{
 		Dim totalRows = 0;
@@ -38,6 +97,7 @@ namespace scene
 	{
 	private:
 		friend class TileLayer;
+		friend class LevelStreamer;
 
 	public:
 		void Configure(GridConfig cfg);
@@ -45,6 +105,18 @@ namespace scene
 
 		void FilterGridMotion(Rect& r, int* dx, int* dy, bool skipVertical = false);
 
+		// Moves r by (dx, dy) in one pass over the cells its leading edges cross and
+		// reports the first contact with a cell holding any of the mask flags.
+		// Cells overlapped at the start are ignored, so a rect never gets stuck.
+		SweepHit SweepAABB(const Rect& r, int dx, int dy, GridIndex mask = GRID_SOLID_TILE);
+
+		// Walks the cells along a ray (Amanatides-Woo) and stops at the first one
+		// holding any of the mask flags. Outside the grid counts as empty.
+		RayHit Raycast(float x, float y, float dirX, float dirY, float maxDist, GridIndex mask = GRID_SOLID_TILE);
+		RayHit Raycast(const Ray& ray, GridIndex mask = GRID_SOLID_TILE);
+		void Raycast(const Ray* rays, RayHit* hits, size_t count, GridIndex mask = GRID_SOLID_TILE);
+		bool HasLineOfSight(float x0, float y0, float x1, float y1, GridIndex mask = GRID_SOLID_TILE);
+
 		bool IsOnSolidGround(Rect& r);
 		int GetGroundSnapDistance(Rect& r);
 		int GetGroundSnapDownDistance(Rect& r);
@@ -54,7 +126,7 @@ namespace scene
 		// Returns 0 if on flat ground, positive for upward slopes, negative for downward slopes
 		float GetSlopeAngle(Rect& r, int sampleDistance = 8);
 
-		GridIndex* Data(void);
+		size_t MemoryUsage(void) const;	// bytes held by distinct chunks and the chunk table
 		void SetGridTile(Dim col, Dim row, GridIndex index);
 		GridIndex GetGridTile(Dim col, Dim row);
 
@@ -64,28 +136,108 @@ namespace scene
 		void SetGridTileTopSolidOnly(Dim col, Dim row);
 		bool CanPassGridTile(Dim col, Dim row, GridIndex flags);
 
-		GridIndex* GetGridTileBlock(Dim colTile, Dim rowTile, Dim tileCols);
-		void SetGridTileBlock(Dim colTile, Dim rowTile, Dim tileCols, GridIndex flags);
+		void SetGridTileBlock(Dim colTile, Dim rowTile, GridIndex flags);
 
-		void ComputeTileGridBlock(TileLayer* tlayer, Dim row, Dim col, Dim tileCols, byte solidThreshold, bool assumtedEmpty);
+		// Derives the whole grid from the alpha coverage of tlayer's tiles, reading
+		// the tileset image once. An element is solid when more than solidThreshold
+		// of its pixels are opaque. Tile rows are spread across all cores, the
+		// result is saved with SaveToRLE.
+		bool BakeFromTileset(const TileLayer& tlayer, const std::string& tilesetPath, byte solidThreshold = 0);
 
-		bool LoadFromCSV(const std::string& csvContent);
+		bool LoadFromCSV(std::string_view csvContent);
+		bool LoadFromCSVFile(const std::string& filePath);	// parses the file in place through a mapping
 
 		// RLE binary format - much faster than CSV for large grids
 		bool LoadFromRLE(const std::string& filePath);
 		bool SaveToRLE(const std::string& filePath) const;
 
-		GridMap() = default;
-		~GridMap() = default;
+		GridMap(void);
+		~GridMap();
 
 	private:
 		void FilterGridMotionDown(Rect& r, int* dy);
 		void FilterGridMotionLeft(Rect& r, int* dx);
 		void FilterGridMotionRight(Rect& r, int* dx);
 		void FilterGridMotionUp(Rect& r, int* dy);
+		bool IsColumnBlocked(int col, int row0, int row1, GridIndex mask);
+		bool IsRowBlocked(int row, int col0, int col1, GridIndex mask);
+
+		// Last chunk touched by a ray walk, rays of a batch usually share chunks
+		struct ChunkCursor
+		{
+			size_t chunk = SIZE_MAX;
+			const GridChunk* data = nullptr;
+		};
+		RayHit CastRay(const Ray& ray, GridIndex mask, ChunkCursor& cursor);
+
+		using ChunkPtr = std::shared_ptr<GridChunk>;
+		class ChunkInterner;
+
+		static const ChunkPtr& EmptyChunk(void);
+		static const ChunkPtr& SolidChunk(void);
+		void StoreChunkRow(Dim chunkRow, const GridCell* cells, ChunkInterner& interner);
+		void ResetChunks(void);
+
+		// GRLE v2 chunks stay in the mapped file until first touched
+		struct RleChunkEntry;
+
+		bool LoadRLEv1(const io::MappedFile& file);
+		bool LoadRLEv2(std::unique_ptr<io::MappedFile> file);
+		void DecodeChunk(size_t chunk) const;
+		void DecodeAllChunks(void) const;
+		void ReleaseSource(void) const;
 
-		bool ComputeIsGridIndexEmpty(Bitmap& gridElem, byte solidThreshold);
-		void ComputeGridBlock(GridIndex* block, Bitmap& tileElem, Bitmap& gridElem, Bitmap& tileSet, byte solidThreshold);
+		// Paging used by LevelStreamer. While the source is kept, chunks that came
+		// unchanged out of it can be dropped and decoded again later.
+		// DecodeSourceChunk only reads the mapping and is safe off the game thread.
+		bool IsSourceChunk(size_t chunk) const;
+		ChunkPtr DecodeSourceChunk(size_t chunk) const;
+		void ReadSourceColumn(size_t chunk, Dim x, GridCell* column) const;	// GRID_CHUNK_SIZE cells
+		void InstallChunk(size_t chunk, ChunkPtr decoded);
+		bool CanEvictChunk(size_t chunk) const;
+		void EvictChunk(size_t chunk);
+		void KeepSource(bool keep);
+
+		// Per column index of the GRID_TOP_SOLID_MASK cells, kept as sorted runs
+		// of consecutive rows. Built on the first query of a column and dropped
+		// again when a load or SetGridTile changes it. Chunks not resident are
+		// read straight from the source, building never decodes a whole chunk.
+		struct SurfaceRun
+		{
+			Dim top = 0, bottom = 0;	// inclusive rows
+		};
+
+		void InvalidateSurfaceIndex(void);
+		void BuildSurfaceColumn(Dim col);
+		int  FirstSurfaceRow(Dim col, int fromRow, int toRow);	// -1 if none
+		float SlopeAngle(int rowDiff, int sampleDistance);
+
+		// Per chunk horizontal distance field of the GRID_SOLID_TILE cells: the low
+		// nibble holds the distance in cells to the nearest solid cell at or left
+		// of a cell, the high nibble the same to the right, both capped. Built on
+		// the first query of a chunk and patched row by row by SetGridTile.
+		struct WallField
+		{
+			byte cells[GRID_CHUNK_SIZE * GRID_CHUNK_SIZE];
+		};
+
+		void InvalidateWallFields(void);
+		const WallField& WallFieldOf(size_t chunk);
+		void ComputeWallFieldRow(WallField& field, size_t chunk, Dim row, Dim col0, Dim col1);
+		void UpdateWallFields(Dim col, Dim row);
+		int  WallDistanceLeft(Dim col, Dim row);	// col and row inside the grid
+		int  WallDistanceRight(Dim col, Dim row);
+
+		// Tileset alpha plane, one byte per pixel
+		struct AlphaImage
+		{
+			std::vector<byte> alpha;
+			int w = 0, h = 0;
+		};
+
+		void ComputeTileGridBlock(const TileLayer& tlayer, Dim col, Dim row, const AlphaImage& tileset, GridCell* band, Dim bandRow0, byte solidThreshold);
+		void ComputeGridBlock(GridCell* block, const AlphaImage& tileset, int tileX, int tileY, Dim blockCols, Dim blockRows, byte solidThreshold);
+		bool ComputeIsGridIndexEmpty(const AlphaImage& tileset, int x, int y, byte solidThreshold);
 
 	private:
 		inline Dim GridBlockColumns();
@@ -97,9 +249,25 @@ namespace scene
 		inline Dim MulGridElementHeight(Dim i);
 		inline Dim GridBlockSizeof();
 		inline bool Valid() const;
+		inline GridCell Cell(Dim col, Dim row) const;
 
 	private:
 		GridConfig m_config{};
-		std::vector<GridIndex> m_grid; 
+		mutable std::vector<ChunkPtr> m_chunks;		// row major, m_chunkCols x m_chunkRows, nullptr until decoded
+		Dim m_chunkCols = 0, m_chunkRows = 0;
+		Dim m_gridCols = 0, m_gridRows = 0;	// size in grid elements
+
+		mutable std::unique_ptr<io::MappedFile> m_source;	// GRLE v2 file backing undecoded chunks
+		mutable const RleChunkEntry* m_sourceDir = nullptr;
+		mutable std::unordered_map<uint32_t, std::weak_ptr<GridChunk>> m_sourceDecoded;	// by data offset, shared entries decode once
+		mutable size_t m_sourcePending = 0;
+		bool m_sourceKept = false;			// streaming, keep the mapping after the last decode
+		std::vector<bool> m_chunkEdited;	// written through SetGridTile, never evicted
+
+		std::vector<std::vector<SurfaceRun>> m_surfaces;	// one run list per grid column
+		std::vector<bool> m_surfaceValid;
+		std::vector<float> m_slopeLut;		// degrees by row difference, see SlopeAngle
+		std::vector<std::unique_ptr<WallField>> m_wallFields;	// per chunk slot, nullptr until queried
+		int m_slopeLutSample = 0;
 	};
 }
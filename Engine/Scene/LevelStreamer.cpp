@@ -0,0 +1,207 @@
+#include "Scene/LevelStreamer.h"
+#include "Scene/GridLayer.h"
+#include "Utils/Assert.h"
+
+#include <algorithm>
+
+namespace scene
+{
+	static inline int FloorDiv(int a, int b)
+	{
+		return a >= 0 ? a / b : -((-a + b - 1) / b);
+	}
+
+	void LevelStreamer::Start(GridMap* grid, const StreamConfig& cfg)
+	{
+		ASSERT(!m_Grid, "Failed. Level streamer is already running!");
+
+		// Nothing to page when the whole grid is already in memory
+		if (!grid || !grid->m_source)
+			return;
+
+		m_Grid = grid;
+		m_Config = cfg;
+		m_ChunkPxW = GRID_CHUNK_SIZE * grid->m_config.gridElementWidth;
+		m_ChunkPxH = GRID_CHUNK_SIZE * grid->m_config.gridElementHeight;
+
+		size_t chunks = grid->m_chunks.size();
+		m_SourceChunks = 0;
+		for (size_t i = 0; i < chunks; ++i)
+			m_SourceChunks += grid->IsSourceChunk(i);
+
+		m_Frame = 0;
+		m_LastWanted.assign(chunks, 0);
+		m_Requested.assign(chunks, false);
+		m_HasLastView = false;
+		m_DirX = m_DirY = 0;
+
+		grid->KeepSource(true);
+		m_Quit = false;
+		m_Worker = std::thread(&LevelStreamer::WorkerLoop, this);
+	}
+
+	void LevelStreamer::Stop(void)
+	{
+		if (!m_Grid)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Quit = true;
+			m_Queue.clear();
+		}
+		m_Wake.notify_one();
+		m_Worker.join();
+
+		// Whatever is still paged out decodes on demand as before
+		m_Decoded.clear();
+		m_Grid->KeepSource(false);
+		m_Grid = nullptr;
+	}
+
+	void LevelStreamer::Update(const Rect& view)
+	{
+		if (!m_Grid)
+			return;
+
+		++m_Frame;
+
+		// Direction of travel sticks until the view moves the other way
+		if (m_HasLastView)
+		{
+			if (view.x != m_LastView.x)
+				m_DirX = number_sign(view.x - m_LastView.x);
+			if (view.y != m_LastView.y)
+				m_DirY = number_sign(view.y - m_LastView.y);
+		}
+		m_LastView = view;
+		m_HasLastView = true;
+
+		InstallDecoded();
+
+		int x1 = view.x - m_Config.marginPx, x2 = view.x + view.w - 1 + m_Config.marginPx;
+		int y1 = view.y - m_Config.marginPx, y2 = view.y + view.h - 1 + m_Config.marginPx;
+		if (m_DirX > 0) x2 += m_Config.prefetchPx; else if (m_DirX < 0) x1 -= m_Config.prefetchPx;
+		if (m_DirY > 0) y2 += m_Config.prefetchPx; else if (m_DirY < 0) y1 -= m_Config.prefetchPx;
+
+		Request(
+			std::max(FloorDiv(x1, m_ChunkPxW), 0),
+			std::max(FloorDiv(y1, m_ChunkPxH), 0),
+			std::min(FloorDiv(x2, m_ChunkPxW), m_Grid->m_chunkCols - 1),
+			std::min(FloorDiv(y2, m_ChunkPxH), m_Grid->m_chunkRows - 1)
+		);
+
+		EvictOverBudget();
+	}
+
+	size_t LevelStreamer::ResidentBytes(void) const
+	{
+		return m_Grid ? (m_SourceChunks - m_Grid->m_sourcePending) * sizeof(GridChunk) : 0;
+	}
+
+	void LevelStreamer::WorkerLoop(void)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		for (;;)
+		{
+			m_Wake.wait(lock, [this] { return m_Quit || !m_Queue.empty(); });
+			if (m_Quit)
+				return;
+
+			size_t chunk = m_Queue.back();
+			m_Queue.pop_back();
+
+			// Decoding only reads the mapped file, the game thread keeps going
+			lock.unlock();
+			ChunkPtr decoded = m_Grid->DecodeSourceChunk(chunk);
+			lock.lock();
+
+			m_Decoded.emplace_back(chunk, std::move(decoded));
+		}
+	}
+
+	void LevelStreamer::Request(int cx1, int cy1, int cx2, int cy2)
+	{
+		int centerX = FloorDiv(m_LastView.x + m_LastView.w / 2, m_ChunkPxW);
+		int centerY = FloorDiv(m_LastView.y + m_LastView.h / 2, m_ChunkPxH);
+
+		m_Wanted.clear();
+		for (int cy = cy1; cy <= cy2; ++cy)
+			for (int cx = cx1; cx <= cx2; ++cx)
+			{
+				size_t chunk = (size_t)cy * m_Grid->m_chunkCols + cx;
+				m_LastWanted[chunk] = m_Frame;
+				if (!m_Grid->m_chunks[chunk] && !m_Requested[chunk])
+					m_Wanted.push_back(chunk);
+			}
+
+		// Farthest first, the worker pops from the back
+		auto distance = [this, centerX, centerY](size_t chunk)
+		{
+			int cx = (int)(chunk % m_Grid->m_chunkCols), cy = (int)(chunk / m_Grid->m_chunkCols);
+			return std::abs(cx - centerX) + std::abs(cy - centerY);
+		};
+		std::sort(m_Wanted.begin(), m_Wanted.end(), [&](size_t a, size_t b) { return distance(a) > distance(b); });
+
+		bool pending;
+		{
+			// Requests the view has moved away from are dropped before they start
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			std::erase_if(m_Queue, [this](size_t chunk)
+			{
+				if (m_LastWanted[chunk] == m_Frame)
+					return false;
+				m_Requested[chunk] = false;
+				return true;
+			});
+
+			for (auto chunk : m_Wanted)
+				m_Requested[chunk] = true;
+			m_Queue.insert(m_Queue.end(), m_Wanted.begin(), m_Wanted.end());
+			pending = !m_Queue.empty();
+		}
+		if (pending)
+			m_Wake.notify_one();
+	}
+
+	void LevelStreamer::InstallDecoded(void)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (m_Decoded.empty())
+				return;
+			m_Installing.swap(m_Decoded);
+		}
+
+		for (auto& [chunk, decoded] : m_Installing)
+		{
+			m_Requested[chunk] = false;
+			m_Grid->InstallChunk(chunk, std::move(decoded));
+		}
+		m_Installing.clear();
+	}
+
+	void LevelStreamer::EvictOverBudget(void)
+	{
+		if (ResidentBytes() <= m_Config.memoryBudget)
+			return;
+
+		// Drop the chunks left behind the longest, down to 3/4 of the budget so
+		// this does not run again every frame. The wanted area is never evicted,
+		// a budget smaller than it only stops everything else from staying.
+		m_Wanted.clear();
+		for (size_t chunk = 0; chunk < m_LastWanted.size(); ++chunk)
+			if (m_LastWanted[chunk] != m_Frame && m_Grid->CanEvictChunk(chunk))
+				m_Wanted.push_back(chunk);
+
+		std::sort(m_Wanted.begin(), m_Wanted.end(), [this](size_t a, size_t b) { return m_LastWanted[a] < m_LastWanted[b]; });
+
+		size_t target = m_Config.memoryBudget / 4 * 3;
+		for (auto chunk : m_Wanted)
+		{
+			if (ResidentBytes() <= target)
+				break;
+			m_Grid->EvictChunk(chunk);
+		}
+	}
+}
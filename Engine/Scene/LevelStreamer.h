@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Utils/Common.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace scene
+{
+	class GridMap;
+	struct GridChunk;
+
+	struct StreamConfig
+	{
+		size_t memoryBudget = 4u << 20;	// bytes of decoded grid chunks kept resident
+		int    marginPx = 256;			// kept loaded around the view on every side
+		int    prefetchPx = 1024;		// extra reach ahead in the direction of travel
+	};
+
+	// Pages GridMap chunks backed by a GRLE v2 file in and out around the camera.
+	// Chunks ahead of the view are decoded on a background thread, chunks far
+	// from it are dropped once the budget is exceeded. A query that reaches an
+	// evicted chunk still decodes it on the spot, so streaming never changes
+	// what the grid answers, only when the work is done.
+	class LevelStreamer final
+	{
+	public:
+		void Start(GridMap* grid, const StreamConfig& cfg);
+		void Stop(void);
+		bool IsRunning(void) const { return m_Grid != nullptr; }
+
+		// Once per frame from the game thread with the visible area in pixels
+		void Update(const Rect& view);
+
+		size_t ResidentBytes(void) const;
+
+		LevelStreamer(void) = default;
+		LevelStreamer(const LevelStreamer&) = delete;
+		LevelStreamer& operator=(const LevelStreamer&) = delete;
+		~LevelStreamer() { Stop(); }
+
+	private:
+		using ChunkPtr = std::shared_ptr<GridChunk>;
+
+		void WorkerLoop(void);
+		void Request(int cx1, int cy1, int cx2, int cy2);
+		void InstallDecoded(void);
+		void EvictOverBudget(void);
+
+	private:
+		GridMap*		m_Grid = nullptr;
+		StreamConfig	m_Config{};
+		size_t			m_SourceChunks = 0;		// chunks with data in the file
+		int				m_ChunkPxW = 0, m_ChunkPxH = 0;
+
+		Rect			m_LastView{};
+		bool			m_HasLastView = false;
+		int				m_DirX = 0, m_DirY = 0;	// last direction of travel
+
+		uint32_t				m_Frame = 0;
+		std::vector<uint32_t>	m_LastWanted;	// frame a chunk was last inside the wanted area
+		std::vector<bool>		m_Requested;	// queued or being decoded
+		std::vector<size_t>		m_Wanted;		// scratch, this frame's requests in order
+		std::vector<std::pair<size_t, ChunkPtr>> m_Installing;	// scratch, swapped with m_Decoded
+
+		// Shared with the worker
+		std::mutex				m_Mutex;
+		std::condition_variable	m_Wake;
+		std::vector<size_t>		m_Queue;		// popped from the back, nearest last
+		std::vector<std::pair<size_t, ChunkPtr>> m_Decoded;
+		bool					m_Quit = false;
+		std::thread				m_Worker;
+	};
+}
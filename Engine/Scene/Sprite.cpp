@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Scene/Sprite.h"
+#include "Animations/FrameClock.h"
 #include "Utils/Assert.h"
 
 namespace scene
@@ -86,11 +87,33 @@ namespace scene
 		return m_BoundingArea;
 	}
 
+	void Sprite::SetCollisionLayer(CollisionLayer layer, CollisionMask mask)
+	{
+		ASSERT(layer < MAX_COLLISION_LAYERS, "FAILED. Collision layer is out of range!");
+		m_CollisionLayer = layer;
+		m_CollisionMask = mask;
+	}
+
+	CollisionLayer Sprite::GetCollisionLayer(void) const
+	{
+		return m_CollisionLayer;
+	}
+
+	CollisionMask Sprite::GetCollisionMask(void) const
+	{
+		return m_CollisionMask;
+	}
+
 	byte Sprite::GetFrame(void)
 	{
 		return m_FrameNo;
 	}
 
+	void Sprite::SetFrameClock(const FrameClock* clock)
+	{
+		m_FrameClock = clock;
+	}
+
 	void Sprite::SetTypeID(const std::string& _id)
 	{
 		m_TypeID = _id;
@@ -123,14 +146,16 @@ namespace scene
 	{
 		ASSERT(m_CurrFilm, "FAILED. Can't display a sprite without a film!");
 
-		const Point& offset = m_CurrFilm->GetFrameOffset(m_FrameNo);
+		const byte frameNo = m_FrameClock ? m_FrameClock->GetCurrFrame() : m_FrameNo;
+		const Rect& frameBox = m_FrameClock ? m_CurrFilm->GetFrameBox(frameNo) : m_FrameBox;
+		const Point& offset = m_CurrFilm->GetFrameOffset(frameNo);
 
 		// Include frame offset in world box for proper clipping
 		Rect worldBox = {
 			m_X + offset.x,
 			m_Y + offset.y,
-			m_FrameBox.w,
-			m_FrameBox.h
+			frameBox.w,
+			frameBox.h
 		};
 
 		Rect clippedBox;
@@ -147,7 +172,7 @@ namespace scene
 			{
 				BitmapBlitFlipped(
 					m_CurrFilm->GetBitmap(),
-					m_FrameBox,
+					frameBox,
 					dest,
 					{ screenX, screenY },
 					true, false
@@ -157,7 +182,7 @@ namespace scene
 			{
 				BitmapBlit(
 					m_CurrFilm->GetBitmap(),
-					m_FrameBox,
+					frameBox,
 					dest,
 					{ screenX, screenY }
 				);
@@ -187,5 +212,10 @@ namespace scene
 			}
 		);
 	}
+
+	Sprite::~Sprite()
+	{
+		ASSERT(m_CollisionSlot < 0, "FAILED. Sprite was destroyed while still in the collision checker!");
+	}
 }
 
@@ -8,10 +8,21 @@
 #include "Animations/AnimationFilm.h"
 #include "Core/LatelyDestroyable.h"
 #include "Physics/BoundingArea.h"
+#include "Physics/CollisionLayer.h"
 
 #include <string>
 #include <functional>
 
+namespace physics
+{
+	class CollisionChecker;
+}
+
+namespace anim
+{
+	class FrameClock;
+}
+
 namespace scene
 {
 	using namespace core;
@@ -44,8 +55,15 @@ namespace scene
 		auto GetBoundingArea(void) const -> const BoundingArea*;
 		bool CollisionCheck(const Sprite* s) const;
 
+		void SetCollisionLayer(CollisionLayer layer, CollisionMask mask);
+		CollisionLayer GetCollisionLayer(void) const;
+		CollisionMask GetCollisionMask(void) const;
+
 		void SetFrame(byte i);
 		byte GetFrame(void);
+
+		// While set, Display shows the clock's current frame instead of m_FrameNo
+		void SetFrameClock(const FrameClock* clock);
 		void SetTypeID(const std::string& _id);
 		auto GetTypeID(void) -> const std::string&;
 		void SetVisibility(bool v);
@@ -63,8 +81,11 @@ namespace scene
 		virtual bool CanPassThroughCeiling() const { return false; }
 
 		Sprite(int _x, int _y, const std::string& _typeID = "");
+		virtual ~Sprite();
 
 	protected:
+		friend class physics::CollisionChecker;
+
 		byte m_FrameNo = 0;
 		Rect m_FrameBox;
 		int m_X = 0;
@@ -72,9 +93,13 @@ namespace scene
 		bool m_IsVisible = false;
 
 		AnimationFilm* m_CurrFilm = nullptr;
+		const FrameClock* m_FrameClock = nullptr;
 		unsigned m_Zorder = 0;
 
 		BoundingArea* m_BoundingArea = nullptr;
+		CollisionLayer m_CollisionLayer = 0;
+		CollisionMask m_CollisionMask = COLLISION_MASK_NONE;
+		int m_CollisionSlot = -1;	// index in the CollisionChecker, -1 when not added
 
 		std::string m_TypeID, m_StateID;
 		Mover m_Mover;
@@ -1,7 +1,10 @@
 #include "Scene/TileLayer.h"
+#include "IO/MappedFile.h"
+#include "IO/CsvReader.h"
+#include "Utils/Assert.h"
 
-#include <sstream>
 #include <string>
+#include <algorithm>
 
 namespace scene
 {
@@ -49,12 +52,13 @@ namespace scene
 		m_map.resize(m_config.totalCols * m_config.totalRows, MakeIndex(UINT16_MAX, UINT16_MAX));
 
 		// Buffer must fit all potentially visible tiles (viewport may span partial tiles)
-		Dim bufferCols = (m_config.viewWindow.w / m_config.tileWidth) + 2;
-		Dim bufferRows = (m_config.viewWindow.h / m_config.tileHeight) + 2;
-		m_dpyBuffer = BitmapCreate(bufferCols * m_config.tileWidth, bufferRows * m_config.tileHeight);
+		m_bufferCols = (m_config.viewWindow.w / m_config.tileWidth) + 2;
+		m_bufferRows = (m_config.viewWindow.h / m_config.tileHeight) + 2;
+		m_dpyBuffer = BitmapCreate(m_bufferCols * m_config.tileWidth, m_bufferRows * m_config.tileHeight);
+		InvalidateTileCache();
 	}
 
-	const TileConfig& TileLayer::Config(void)
+	const TileConfig& TileLayer::Config(void) const
 	{
 		return m_config;
 	}
@@ -62,12 +66,13 @@ namespace scene
 	void TileLayer::SetTile(Dim col, Dim row, Index index)
 	{
 		m_map[row * m_config.totalCols + col] = index;
+		InvalidateTileCache();
 	}
 
 	Index TileLayer::GetTile(Dim col, Dim row) const
 	{
 		// Bounds check - return empty tile if out of range
-		if (col >= m_config.totalCols || row >= m_config.totalRows)
+		if (col < 0 || col >= m_config.totalCols || row < 0 || row >= m_config.totalRows)
 			return MakeIndex(UINT16_MAX, UINT16_MAX);
 		return m_map[row * m_config.totalCols + col];
 	}
@@ -105,7 +110,9 @@ namespace scene
 
 	/*static*/ Index TileLayer::MakeIndex(Dim row, Dim col)
 	{
-		return (Index(row) << 16) | Index(col);
+		// Tileset positions stay packed, two PackedDim halves per map entry
+		ASSERT(row >= 0 && row <= UINT16_MAX && col >= 0 && col <= UINT16_MAX, "Failed. Tileset position does not fit a packed tile index!");
+		return (Index(PackedDim(row)) << 16) | Index(PackedDim(col));
 	}
 
 	const Rect& TileLayer::GetViewWindow(void)
@@ -119,38 +126,88 @@ namespace scene
 		m_dpyChanged = true;
 	}
 
+	void TileLayer::InvalidateTileCache(void)
+	{
+		m_cacheValid = false;
+		m_dpyChanged = true;
+	}
+
+	void TileLayer::UpdateTileCache(const Rect& visible)
+	{
+		bool redrawAll = !m_cacheValid;
+
+		// Clear buffer before rendering (transparent for empty tiles)
+		if (redrawAll)
+			BitmapClear(m_dpyBuffer, MakeColor(0, 0, 0, 0));
+
+		for (Dim row = visible.y; row < visible.y + visible.h; ++row)
+			for (Dim col = visible.x; col < visible.x + visible.w; ++col)
+			{
+				bool cached =
+					col >= m_cachedTiles.x && col < m_cachedTiles.x + m_cachedTiles.w &&
+					row >= m_cachedTiles.y && row < m_cachedTiles.y + m_cachedTiles.h;
+				if (!redrawAll && cached)
+					continue;
+
+				Dim x = MulTileWidth(col % m_bufferCols);
+				Dim y = MulTileHeight(row % m_bufferRows);
+
+				// The slot still holds a tile that scrolled out
+				if (!redrawAll)
+					BitmapFillRect(m_dpyBuffer, { x, y, m_config.tileWidth, m_config.tileHeight }, MakeColor(0, 0, 0, 0));
+
+				PutTile(m_dpyBuffer, x, y, m_tileset, GetTile(col, row));
+			}
+
+		m_cachedTiles = visible;
+		m_cacheValid = true;
+	}
+
 	void TileLayer::Display(Bitmap& dest, const Point& dp)
 	{
+		int bufferW = MulTileWidth(m_bufferCols);
+		int bufferH = MulTileHeight(m_bufferRows);
+
 		if (m_dpyChanged)
 		{
 			auto startCol = DivTileWidth(m_config.viewWindow.x);
 			auto startRow = DivTileHeight(m_config.viewWindow.y);
 			auto endCol = DivTileWidth(m_config.viewWindow.x + m_config.viewWindow.w - 1);
 			auto endRow = DivTileHeight(m_config.viewWindow.y + m_config.viewWindow.h - 1);
-			m_dpyX = ModTileWidth(m_config.viewWindow.x);
-			m_dpyY = ModTileHeight(m_config.viewWindow.y);
-			m_dpyChanged = false;
 
-			// Clear buffer before rendering (transparent for empty tiles)
-			BitmapClear(m_dpyBuffer, MakeColor(0, 0, 0, 0));
+			UpdateTileCache({
+				(int)startCol,
+				(int)startRow,
+				(int)(endCol - startCol + 1),
+				(int)(endRow - startRow + 1)
+			});
 
-			for (Dim row = startRow; row <= endRow; ++row)
-				for (Dim col = startCol; col <= endCol; ++col)
-					PutTile(
-						m_dpyBuffer,
-						MulTileWidth(col - startCol),
-						MulTileHeight(row - startRow),
-						m_tileset,
-						GetTile(col, row)  // Fixed: was GetTile(row, col)
-					);
+			m_dpyX = m_config.viewWindow.x % bufferW;
+			m_dpyY = m_config.viewWindow.y % bufferH;
+			m_dpyChanged = false;
 		}
 
-		BitmapBlit(
-			m_dpyBuffer,
-			{ m_dpyX, m_dpyY, m_config.viewWindow.w, m_config.viewWindow.h },
-			dest,
-			{ dp.x, dp.y }
-		);
+		// The view may wrap around the right and bottom buffer edges
+		int leftW = std::min(m_config.viewWindow.w, bufferW - m_dpyX);
+		int topH = std::min(m_config.viewWindow.h, bufferH - m_dpyY);
+		int spans[2][3] = {
+			{ m_dpyX, 0, leftW },
+			{ 0, leftW, m_config.viewWindow.w - leftW }
+		};
+		int rows[2][3] = {
+			{ m_dpyY, 0, topH },
+			{ 0, topH, m_config.viewWindow.h - topH }
+		};
+
+		for (auto& r : rows)
+			for (auto& c : spans)
+				if (r[2] > 0 && c[2] > 0)
+					BitmapBlit(
+						m_dpyBuffer,
+						{ c[0], r[0], c[2], r[2] },
+						dest,
+						{ dp.x + c[1], dp.y + r[1] }
+					);
 	}
 
 	Bitmap TileLayer::GetBitmap(void) const
@@ -220,51 +277,43 @@ namespace scene
 		return (m_config.viewWindow.y >= -dy) && (m_config.viewWindow.y + m_config.viewWindow.h + dy) <= (m_config.totalRows * m_config.tileHeight);
 	}
 
-	bool TileLayer::LoadFromCSV(const std::string& context)
+	bool TileLayer::LoadFromCSV(std::string_view context)
 	{
-		std::istringstream stream(context);
-		std::string line;
-		Dim row = 0;
-
-		while (std::getline(stream, line) && row < m_config.totalRows)
-		{
-			if (line.empty())
-				continue;
-
-			std::istringstream lineStream(line);
-			std::string cell;
-			Dim col = 0;
-
-			while (std::getline(lineStream, cell, ',') && col < m_config.totalCols)
+		// Rows are parsed in parallel and written straight into m_map, each
+		// worker only touches its own rows
+		bool parsed = io::ParseIntCSV(context, m_config.totalRows, m_config.totalCols,
+			[this](size_t row, const int* values)
 			{
-				int value = std::stoi(cell);
-
-				if (value == -1)
-					SetTile(col, row, MakeIndex(UINT16_MAX, UINT16_MAX));
-				else
+				Index* dest = m_map.data() + row * m_config.totalCols;
+				for (Dim col = 0; col < m_config.totalCols; ++col)
 				{
-					// Convert linear index to tileset grid position
-					Dim tileRow = value / m_config.tilesetCols;
-					Dim tileCol = value % m_config.tilesetCols;
-					// Calculate pixel position with offset and margin
-					Dim px = m_config.tilesetOffsetX + tileCol * (m_config.tileWidth + m_config.tilesetMarginX);
-					Dim py = m_config.tilesetOffsetY + tileRow * (m_config.tileHeight + m_config.tilesetMarginY);
-					SetTile(col, row, MakeIndex(py, px));
+					int value = values[col];
+					if (value == -1)
+						dest[col] = MakeIndex(UINT16_MAX, UINT16_MAX);
+					else
+					{
+						// Convert linear index to tileset grid position
+						Dim tileRow = value / m_config.tilesetCols;
+						Dim tileCol = value % m_config.tilesetCols;
+						// Calculate pixel position with offset and margin
+						Dim px = m_config.tilesetOffsetX + tileCol * (m_config.tileWidth + m_config.tilesetMarginX);
+						Dim py = m_config.tilesetOffsetY + tileRow * (m_config.tileHeight + m_config.tilesetMarginY);
+						dest[col] = MakeIndex(py, px);
+					}
 				}
+			});
 
-				++col;
-			}
-
-			if (col != m_config.totalCols)
-				return false; // Column count mismatch
-
-			++row;
-		}
+		InvalidateTileCache();
+		return parsed; // false on a row or column count mismatch
+	}
 
-		if (row != m_config.totalRows)
-			return false; // Row count mismatch
+	bool TileLayer::LoadFromCSVFile(const std::string& filePath)
+	{
+		io::MappedFile file;
+		if (!file.Open(filePath))
+			return false;
 
-		return true;
+		return LoadFromCSV(std::string_view(reinterpret_cast<const char*>(file.Data()), file.Size()));
 	}
 
 	void TileLayer::SetTileset(Bitmap tileset)
@@ -272,5 +321,6 @@ namespace scene
 		if (m_tileset)
 			BitmapDestroy(m_tileset);
 		m_tileset = tileset;
+		InvalidateTileCache();
 	}
 }
\ No newline at end of file
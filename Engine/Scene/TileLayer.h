@@ -4,6 +4,8 @@
 #include "Utils/Common.h"
 #include "Core/LatelyDestroyable.h"
 
+#include <string>
+#include <string_view>
 #include <vector>
 #include <functional>
 
@@ -34,7 +36,7 @@ namespace scene
 	{
 	public:
 		void				Configure(TileConfig& cfg);
-		const TileConfig&	Config(void);
+		const TileConfig&	Config(void) const;
 
 		void		SetTile(Dim col, Dim row, Index index);
 		Index		GetTile(Dim col, Dim row) const;
@@ -61,7 +63,8 @@ namespace scene
 		bool CanScrollHoriz(float dx) const;
 		bool CanScrollVert(float dy) const;
 
-		bool LoadFromCSV(const std::string& context);
+		bool LoadFromCSV(std::string_view context);
+		bool LoadFromCSVFile(const std::string& filePath);	// parses the file in place through a mapping
 		void SetTileset(Bitmap tileset);
 
 		TileLayer() = default;
@@ -75,6 +78,9 @@ namespace scene
 		inline Index ModTileWidth(Index i);
 		inline Index ModTileHeight(Index i);
 
+		void UpdateTileCache(const Rect& visible);
+		void InvalidateTileCache(void);
+
 	private:
 		using MapContainer = std::vector<Index>;
 
@@ -85,5 +91,12 @@ namespace scene
 		Bitmap		 m_dpyBuffer = nullptr;
 		bool		 m_dpyChanged = true;
 		Dim			 m_dpyX = 0, m_dpyY = 0;
+
+		// m_dpyBuffer is a toroidal tile cache: map tile (col, row) always lives in
+		// slot (col % m_bufferCols, row % m_bufferRows), so scrolling only draws
+		// the tiles that enter the view and the copy out wraps around the edges.
+		Dim			 m_bufferCols = 0, m_bufferRows = 0;
+		Rect		 m_cachedTiles{};		// visible tile range held by the cache
+		bool		 m_cacheValid = false;
 	};
 }
\ No newline at end of file
@@ -3,7 +3,8 @@
 #include <cstdint>
 
 typedef uint8_t  byte;
-typedef uint16_t Dim;
+typedef int32_t  Dim;		// world, grid and tile coordinates, signed like Rect and Point
+typedef uint16_t PackedDim;	// 16-bit storage for ranges that stay small, e.g. tileset positions
 
 typedef uint64_t Time;
 typedef uint64_t TimeStamp;